@@ -3,11 +3,17 @@
  * License, v. 2.0. If a copy of the MPL was not distributed with this file,
  * You can obtain one at http://mozilla.org/MPL/2.0/. */
 
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "base/base64.h"
 #include "base/path_service.h"
 #include "base/task/post_task.h"
 #include "base/test/thread_test_helper.h"
 #include "brave/browser/brave_browser_process_impl.h"
+#include "brave/browser/net/brave_ad_block_tp_network_delegate_helper.h"
 #include "brave/common/brave_paths.h"
 #include "brave/common/pref_names.h"
 #include "brave/components/brave_shields/browser/ad_block_custom_filters_service.h"
@@ -15,6 +21,7 @@
 #include "brave/components/brave_shields/browser/ad_block_regional_service_manager.h"
 #include "brave/components/brave_shields/browser/ad_block_service.h"
 #include "brave/components/brave_shields/browser/brave_shields_util.h"
+#include "brave/components/brave_shields/browser/brave_shields_web_contents_observer.h"
 #include "brave/components/brave_shields/browser/tracking_protection_service.h"
 #include "brave/components/brave_shields/common/brave_shield_constants.h"
 #include "brave/components/brave_shields/common/features.h"
@@ -79,6 +86,14 @@ class AdBlockServiceTest : public ExtensionBrowserTest {
   void SetUpOnMainThread() override {
     ExtensionBrowserTest::SetUpOnMainThread();
     host_resolver()->AddRule("*", "127.0.0.1");
+    brave_shields::BraveShieldsWebContentsObserver::
+        SetDispatchImmediatelyForTesting(true);
+  }
+
+  void TearDownOnMainThread() override {
+    brave_shields::BraveShieldsWebContentsObserver::
+        SetDispatchImmediatelyForTesting(false);
+    ExtensionBrowserTest::TearDownOnMainThread();
   }
 
   void SetUp() override {
@@ -106,9 +121,10 @@ class AdBlockServiceTest : public ExtensionBrowserTest {
         g_brave_browser_process->ad_block_service()->TagExists(tag);
     ASSERT_EQ(exists_default, expected_exists);
 
-    for (const auto& regional_service :
-         g_brave_browser_process->ad_block_regional_service_manager()
-             ->regional_services_) {
+    auto regional_services =
+        g_brave_browser_process->ad_block_regional_service_manager()
+            ->GetRegionalServices();
+    for (const auto& regional_service : *regional_services) {
       bool exists_regional = regional_service.second->TagExists(tag);
       ASSERT_EQ(exists_regional, expected_exists);
     }
@@ -201,12 +217,13 @@ class AdBlockServiceTest : public ExtensionBrowserTest {
     g_brave_browser_process->ad_block_regional_service_manager()
         ->EnableFilterList(uuid, true);
     EXPECT_EQ(g_brave_browser_process->ad_block_regional_service_manager()
-                  ->regional_services_.size(),
+                  ->GetRegionalServices()->size(),
               1ULL);
 
-    auto regional_service =
+    auto regional_services =
         g_brave_browser_process->ad_block_regional_service_manager()
-            ->regional_services_.find(uuid);
+            ->GetRegionalServices();
+    auto regional_service = regional_services->find(uuid);
     regional_service->second->OnComponentReady(ad_block_extension->id(),
                                                ad_block_extension->path(), "");
     WaitForAdBlockServiceThreads();
@@ -248,6 +265,15 @@ class AdBlockServiceTest : public ExtensionBrowserTest {
     ASSERT_TRUE(io_helper->Run());
   }
 
+  void WaitForCustomFiltersCompiled() {
+    scoped_refptr<base::ThreadTestHelper> compile_helper(
+        new base::ThreadTestHelper(
+            g_brave_browser_process->ad_block_custom_filters_service()
+                ->GetCompileTaskRunnerForTesting()));
+    ASSERT_TRUE(compile_helper->Run());
+    WaitForAdBlockServiceThreads();
+  }
+
   void WaitForBraveExtensionShieldsDataReady() {
     // Sometimes, the page can start loading before the Shields panel has
     // received information about the window and tab it's loaded in.
@@ -286,6 +312,7 @@ IN_PROC_BROWSER_TEST_F(AdBlockServiceTest,
                        NotAdsDoNotGetBlockedByCustomBlocker) {
   ASSERT_TRUE(g_brave_browser_process->ad_block_custom_filters_service()
                   ->UpdateCustomFilters("*ad_banner.png"));
+  WaitForCustomFiltersCompiled();
 
   EXPECT_EQ(browser()->profile()->GetPrefs()->GetUint64(kAdsBlocked), 0ULL);
 
@@ -309,6 +336,7 @@ IN_PROC_BROWSER_TEST_F(AdBlockServiceTest, AdsGetBlockedByCustomBlocker) {
   EXPECT_EQ(browser()->profile()->GetPrefs()->GetUint64(kAdsBlocked), 0ULL);
   ASSERT_TRUE(g_brave_browser_process->ad_block_custom_filters_service()
                   ->UpdateCustomFilters("*ad_banner.png"));
+  WaitForCustomFiltersCompiled();
 
   GURL url = embedded_test_server()->GetURL(kAdBlockTestPage);
   ui_test_utils::NavigateToURL(browser(), url);
@@ -813,6 +841,145 @@ IN_PROC_BROWSER_TEST_F(AdBlockServiceTest, RedirectRulesAreRespected) {
   EXPECT_EQ(browser()->profile()->GetPrefs()->GetUint64(kAdsBlocked), 1ULL);
 }
 
+class CnameAdBlockServiceTest : public AdBlockServiceTest {
+ public:
+  CnameAdBlockServiceTest() {}
+
+  void SetUpOnMainThread() override {
+    AdBlockServiceTest::SetUpOnMainThread();
+    brave::SetCanonicalNameResolverForTesting(base::BindRepeating(
+        &CnameAdBlockServiceTest::ResolveCanonicalName,
+        base::Unretained(this)));
+  }
+
+  void TearDownOnMainThread() override {
+    brave::SetCanonicalNameResolverForTesting(
+        brave::CanonicalNameResolverForTesting());
+    AdBlockServiceTest::TearDownOnMainThread();
+  }
+
+  void ResolveCanonicalName(
+      const GURL& url,
+      base::OnceCallback<void(base::Optional<std::string>)> callback) {
+    resolve_counts_[url.host()]++;
+    if (url.host() == held_host_) {
+      held_resolutions_.push_back(std::move(callback));
+      return;
+    }
+    const auto iter = canonical_names_.find(url.host());
+    if (iter == canonical_names_.end()) {
+      std::move(callback).Run(base::nullopt);
+      return;
+    }
+    std::move(callback).Run(iter->second);
+  }
+
+  bool AddImageAndExpect(const GURL& url, const std::string& expectations) {
+    content::WebContents* contents =
+        browser()->tab_strip_model()->GetActiveWebContents();
+    bool as_expected = false;
+    EXPECT_TRUE(ExecuteScriptAndExtractBool(
+        contents,
+        base::StringPrintf("setExpectations(%s);"
+                           "addImage('%s')",
+                           expectations.c_str(), url.spec().c_str()),
+        &as_expected));
+    return as_expected;
+  }
+
+ protected:
+  std::map<std::string, std::string> canonical_names_;
+  std::map<std::string, int> resolve_counts_;
+  // Resolutions for this host do not complete until the test runs them, to
+  // check that they are not waited on
+  std::string held_host_;
+  std::vector<base::OnceCallback<void(base::Optional<std::string>)>>
+      held_resolutions_;
+};
+
+// Load an image from a host which is an alias of a blocked host, and make sure
+// it is blocked.
+IN_PROC_BROWSER_TEST_F(CnameAdBlockServiceTest,
+                       CnameCloakedRequestsGetBlocked) {
+  UpdateAdBlockInstanceWithRules("||tracker.com^");
+  canonical_names_["cloaked.example.com"] = "ads.tracker.com";
+  EXPECT_EQ(browser()->profile()->GetPrefs()->GetUint64(kAdsBlocked), 0ULL);
+
+  ui_test_utils::NavigateToURL(
+      browser(), embedded_test_server()->GetURL("b.com", kAdBlockTestPage));
+
+  EXPECT_TRUE(AddImageAndExpect(
+      embedded_test_server()->GetURL("cloaked.example.com", "/logo.png"),
+      "0, 0, 1, 0, 0, 0"));
+  EXPECT_EQ(browser()->profile()->GetPrefs()->GetUint64(kAdsBlocked), 1ULL);
+  EXPECT_EQ(1, resolve_counts_["cloaked.example.com"]);
+}
+
+// Requests blocked by the first pass on the original URL must not wait for
+// the canonical name, which is resolved concurrently.
+IN_PROC_BROWSER_TEST_F(CnameAdBlockServiceTest,
+                       FirstPassBlockDoesNotWaitForCanonicalName) {
+  UpdateAdBlockInstanceWithRules("||blocked.example.com^");
+  held_host_ = "blocked.example.com";
+
+  ui_test_utils::NavigateToURL(
+      browser(), embedded_test_server()->GetURL("b.com", kAdBlockTestPage));
+
+  EXPECT_TRUE(AddImageAndExpect(
+      embedded_test_server()->GetURL("blocked.example.com", "/logo.png"),
+      "0, 0, 1, 0, 0, 0"));
+  EXPECT_EQ(browser()->profile()->GetPrefs()->GetUint64(kAdsBlocked), 1ULL);
+  EXPECT_EQ(1, resolve_counts_["blocked.example.com"]);
+  EXPECT_EQ(1u, held_resolutions_.size());
+
+  // Completing the resolution afterwards must not affect the finished request
+  std::move(held_resolutions_.front()).Run(std::string("ads.tracker.com"));
+  held_resolutions_.clear();
+}
+
+// Requests which the first pass allows wait for the canonical name before
+// they complete.
+IN_PROC_BROWSER_TEST_F(CnameAdBlockServiceTest,
+                       FirstPassAllowWaitsForCanonicalName) {
+  UpdateAdBlockInstanceWithRules("||tracker.com^");
+  canonical_names_["cloaked.example.com"] = "ads.tracker.com";
+  canonical_names_["example.com"] = "cdn.example.net";
+
+  ui_test_utils::NavigateToURL(
+      browser(), embedded_test_server()->GetURL("b.com", kAdBlockTestPage));
+
+  EXPECT_TRUE(AddImageAndExpect(
+      embedded_test_server()->GetURL("example.com", "/logo.png"),
+      "1, 0, 0, 0, 0, 0"));
+  EXPECT_TRUE(AddImageAndExpect(
+      embedded_test_server()->GetURL("cloaked.example.com", "/logo.png"),
+      "1, 0, 1, 0, 0, 0"));
+  EXPECT_EQ(browser()->profile()->GetPrefs()->GetUint64(kAdsBlocked), 1ULL);
+  EXPECT_EQ(1, resolve_counts_["example.com"]);
+  EXPECT_EQ(1, resolve_counts_["cloaked.example.com"]);
+}
+
+// Later requests to the same host use the cached canonical name rather than
+// resolving it again.
+IN_PROC_BROWSER_TEST_F(CnameAdBlockServiceTest, CanonicalNameIsCached) {
+  UpdateAdBlockInstanceWithRules("||tracker.com^");
+  canonical_names_["cloaked.example.com"] = "ads.tracker.com";
+
+  ui_test_utils::NavigateToURL(
+      browser(), embedded_test_server()->GetURL("b.com", kAdBlockTestPage));
+
+  EXPECT_TRUE(AddImageAndExpect(
+      embedded_test_server()->GetURL("cloaked.example.com", "/logo.png?1"),
+      "0, 0, 1, 0, 0, 0"));
+  EXPECT_EQ(1, resolve_counts_["cloaked.example.com"]);
+
+  EXPECT_TRUE(AddImageAndExpect(
+      embedded_test_server()->GetURL("cloaked.example.com", "/logo.png?2"),
+      "0, 0, 2, 0, 0, 0"));
+  EXPECT_EQ(1, resolve_counts_["cloaked.example.com"]);
+  EXPECT_EQ(browser()->profile()->GetPrefs()->GetUint64(kAdsBlocked), 2ULL);
+}
+
 class CosmeticFilteringFlagDisabledTest : public AdBlockServiceTest {
  public:
   CosmeticFilteringFlagDisabledTest() {
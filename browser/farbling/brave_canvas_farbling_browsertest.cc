@@ -0,0 +1,163 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <string>
+
+#include "base/path_service.h"
+#include "brave/browser/brave_content_browser_client.h"
+#include "brave/common/brave_paths.h"
+#include "brave/components/brave_shields/browser/brave_shields_util.h"
+#include "chrome/browser/content_settings/host_content_settings_map_factory.h"
+#include "chrome/browser/ui/browser.h"
+#include "chrome/common/chrome_content_client.h"
+#include "chrome/test/base/in_process_browser_test.h"
+#include "chrome/test/base/ui_test_utils.h"
+#include "content/public/test/browser_test.h"
+#include "content/public/test/browser_test_utils.h"
+#include "net/dns/mock_host_resolver.h"
+
+using brave_shields::ControlType;
+
+namespace {
+
+const char kEmbeddedTestServerDirectory[] = "canvas";
+const char kCanvasPage[] = "/getimagedata-farbling.html";
+const char kDataURLScript[] = "domAutomationController.send(dataURL());";
+const char kImageDataScript[] = "domAutomationController.send(imageData());";
+
+}  // namespace
+
+class BraveCanvasFarblingBrowserTest : public InProcessBrowserTest {
+ public:
+  void SetUpOnMainThread() override {
+    InProcessBrowserTest::SetUpOnMainThread();
+
+    content_client_.reset(new ChromeContentClient);
+    content::SetContentClient(content_client_.get());
+    browser_content_client_.reset(new BraveContentBrowserClient());
+    content::SetBrowserClientForTesting(browser_content_client_.get());
+
+    host_resolver()->AddRule("*", "127.0.0.1");
+
+    brave::RegisterPathProvider();
+    base::FilePath test_data_dir;
+    base::PathService::Get(brave::DIR_TEST_DATA, &test_data_dir);
+    test_data_dir = test_data_dir.AppendASCII(kEmbeddedTestServerDirectory);
+    embedded_test_server()->ServeFilesFromDirectory(test_data_dir);
+
+    ASSERT_TRUE(embedded_test_server()->Start());
+
+    url_ = embedded_test_server()->GetURL("a.com", kCanvasPage);
+  }
+
+  void TearDown() override {
+    browser_content_client_.reset();
+    content_client_.reset();
+  }
+
+  HostContentSettingsMap* content_settings() {
+    return HostContentSettingsMapFactory::GetForProfile(browser()->profile());
+  }
+
+  void BlockFingerprinting() {
+    brave_shields::SetFingerprintingControlType(
+        content_settings(), ControlType::BLOCK, url_);
+  }
+
+  void SetFingerprintingDefault() {
+    brave_shields::SetFingerprintingControlType(
+        content_settings(), ControlType::DEFAULT, url_);
+  }
+
+  content::WebContents* contents() {
+    return browser()->tab_strip_model()->GetActiveWebContents();
+  }
+
+  void NavigateToCanvasPage() {
+    ui_test_utils::NavigateToURL(browser(), url_);
+    ASSERT_TRUE(content::WaitForLoadStop(contents()));
+  }
+
+  void Draw(const std::string& color) {
+    ASSERT_TRUE(content::ExecuteScript(contents(), "draw('" + color + "');"));
+  }
+
+  void Resize(int width, int height) {
+    ASSERT_TRUE(content::ExecuteScript(
+        contents(), "resize(" + std::to_string(width) + ", " +
+                        std::to_string(height) + ");"));
+  }
+
+  std::string ExecScriptGetStr(const std::string& script) {
+    std::string value;
+    EXPECT_TRUE(ExecuteScriptAndExtractString(contents(), script, &value));
+    return value;
+  }
+
+  // Checks that extracting the same canvas contents again, whether or not the
+  // perturbed copy is still cached, farbles them identically.
+  void ExpectRepeatedExtractionsMatch() {
+    const std::string data_url = ExecScriptGetStr(kDataURLScript);
+    const std::string image_data = ExecScriptGetStr(kImageDataScript);
+    EXPECT_EQ(data_url, ExecScriptGetStr(kDataURLScript));
+    EXPECT_EQ(image_data, ExecScriptGetStr(kImageDataScript));
+    EXPECT_EQ(data_url, ExecScriptGetStr(kDataURLScript));
+  }
+
+  // Draws |color| on a freshly loaded page, where nothing has been cached yet.
+  std::string GetUncachedDataURL(const std::string& color) {
+    NavigateToCanvasPage();
+    Draw(color);
+    return ExecScriptGetStr(kDataURLScript);
+  }
+
+  void TestExtraction() {
+    const std::string red_data_url = GetUncachedDataURL("red");
+    const std::string blue_data_url = GetUncachedDataURL("blue");
+    ASSERT_NE(red_data_url, blue_data_url);
+
+    NavigateToCanvasPage();
+    Draw("red");
+    ExpectRepeatedExtractionsMatch();
+    EXPECT_EQ(red_data_url, ExecScriptGetStr(kDataURLScript));
+
+    // Redrawing must not hand out the copy perturbed for the old contents
+    Draw("blue");
+    ExpectRepeatedExtractionsMatch();
+    EXPECT_EQ(blue_data_url, ExecScriptGetStr(kDataURLScript));
+
+    Draw("red");
+    EXPECT_EQ(red_data_url, ExecScriptGetStr(kDataURLScript));
+  }
+
+ private:
+  GURL url_;
+  std::unique_ptr<ChromeContentClient> content_client_;
+  std::unique_ptr<BraveContentBrowserClient> browser_content_client_;
+};
+
+IN_PROC_BROWSER_TEST_F(BraveCanvasFarblingBrowserTest,
+                       ReuseFarbledExtractionUntilRedrawn) {
+  BlockFingerprinting();
+  TestExtraction();
+
+  SetFingerprintingDefault();
+  TestExtraction();
+}
+
+IN_PROC_BROWSER_TEST_F(BraveCanvasFarblingBrowserTest,
+                       FarbleCanvasTooLargeToCache) {
+  BlockFingerprinting();
+  NavigateToCanvasPage();
+  // 2400x2400 RGBA pixels exceed the perturbed image cache budget
+  Resize(2400, 2400);
+  Draw("red");
+  ExpectRepeatedExtractionsMatch();
+  const std::string red_data_url = ExecScriptGetStr(kDataURLScript);
+
+  Draw("blue");
+  ExpectRepeatedExtractionsMatch();
+  EXPECT_NE(red_data_url, ExecScriptGetStr(kDataURLScript));
+}
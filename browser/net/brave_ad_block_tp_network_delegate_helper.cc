@@ -11,7 +11,12 @@
 #include <vector>
 
 #include "base/base64url.h"
+#include "base/containers/mru_cache.h"
+#include "base/memory/ptr_util.h"
+#include "base/no_destructor.h"
 #include "base/strings/string_util.h"
+#include "base/supports_user_data.h"
+#include "base/task_runner_util.h"
 #include "brave/browser/brave_browser_process_impl.h"
 #include "brave/browser/net/url_context.h"
 #include "brave/common/network_constants.h"
@@ -27,6 +32,7 @@
 #include "content/public/browser/web_contents.h"
 #include "extensions/common/url_pattern.h"
 #include "mojo/public/cpp/bindings/remote.h"
+#include "net/base/network_isolation_key.h"
 #include "services/network/network_context.h"
 #include "ui/base/resource/resource_bundle.h"
 #include "url/url_canon.h"
@@ -35,6 +41,91 @@ namespace brave {
 
 namespace {
 
+// Canonical names are remembered for a short time per profile so that
+// repeated subresources from the same host don't each wait on the resolver.
+// They are keyed by network isolation key as well as host, as that is what
+// the resolver partitions its own cache by.
+constexpr size_t kCanonicalNameCacheSize = 256;
+constexpr base::TimeDelta kCanonicalNameCacheTTL =
+    base::TimeDelta::FromMinutes(1);
+
+const char kCanonicalNameCacheKey[] = "brave_adblock_canonical_name_cache";
+
+class CanonicalNameCache : public base::SupportsUserData::Data {
+ public:
+  CanonicalNameCache() : cache_(kCanonicalNameCacheSize) {}
+  ~CanonicalNameCache() override = default;
+
+  static CanonicalNameCache* FromBrowserContext(
+      content::BrowserContext* context) {
+    DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+    auto* cache = static_cast<CanonicalNameCache*>(
+        context->GetUserData(kCanonicalNameCacheKey));
+    if (!cache) {
+      cache = new CanonicalNameCache();
+      context->SetUserData(kCanonicalNameCacheKey, base::WrapUnique(cache));
+    }
+    return cache;
+  }
+
+  bool Get(const net::NetworkIsolationKey& network_isolation_key,
+           const std::string& host,
+           std::string* canonical_name) {
+    // Transient keys are never shared with another request
+    if (network_isolation_key.IsTransient()) {
+      return false;
+    }
+    auto it = cache_.Get(Key(network_isolation_key, host));
+    if (it == cache_.end()) {
+      return false;
+    }
+    if (base::TimeTicks::Now() - it->second.resolved_at >
+        kCanonicalNameCacheTTL) {
+      cache_.Erase(it);
+      return false;
+    }
+    *canonical_name = it->second.canonical_name;
+    return true;
+  }
+
+  void Put(const net::NetworkIsolationKey& network_isolation_key,
+           const std::string& host,
+           const std::string& canonical_name) {
+    if (network_isolation_key.IsTransient()) {
+      return;
+    }
+    cache_.Put(Key(network_isolation_key, host),
+               {canonical_name, base::TimeTicks::Now()});
+  }
+
+ private:
+  using Key = std::pair<net::NetworkIsolationKey, std::string>;
+
+  struct Entry {
+    std::string canonical_name;
+    base::TimeTicks resolved_at;
+  };
+
+  base::MRUCache<Key, Entry> cache_;
+
+  DISALLOW_COPY_AND_ASSIGN(CanonicalNameCache);
+};
+
+// State shared between the first adblock pass on the original URL and the
+// concurrent canonical name resolution for the same request. Only accessed on
+// the UI thread.
+struct CnameBlockingState {
+  bool done = false;
+  bool first_pass_allowed = false;
+  bool canonical_name_resolved = false;
+  base::Optional<std::string> canonical_name;
+};
+
+CanonicalNameResolverForTesting& GetCanonicalNameResolverForTesting() {
+  static base::NoDestructor<CanonicalNameResolverForTesting> resolver;
+  return *resolver;
+}
+
 content::WebContents* GetWebContents(int render_process_id,
                                      int render_frame_id,
                                      int frame_tree_node_id) {
@@ -52,30 +143,55 @@ content::WebContents* GetWebContents(int render_process_id,
   return web_contents;
 }
 
+bool ShouldCheckCanonicalName(std::shared_ptr<BraveRequestInfo> ctx,
+                              const base::Optional<std::string>& cname) {
+  return cname.has_value() && ctx->request_url.host() != *cname &&
+         *cname != "";
+}
+
 }  // namespace
 
-void ShouldBlockAdOnTaskRunner(std::shared_ptr<BraveRequestInfo> ctx,
-                               base::Optional<std::string> canonical_name) {
+// Returns true if the request was neither blocked nor matched by an exception
+// filter, in which case the canonical name of the host still needs checking.
+bool ShouldBlockAdFirstPassOnTaskRunner(
+    std::shared_ptr<BraveRequestInfo> ctx) {
   bool did_match_exception = false;
   std::string tab_host = ctx->tab_origin.host();
   if (!g_brave_browser_process->ad_block_service()->ShouldStartRequest(
           ctx->request_url, ctx->resource_type, tab_host, &did_match_exception,
           &ctx->cancel_request_explicitly, &ctx->mock_data_url)) {
     ctx->blocked_by = kAdBlocked;
-  } else if (!did_match_exception && canonical_name.has_value() &&
-             ctx->request_url.host() != *canonical_name &&
-             *canonical_name != "") {
-    GURL::Replacements replacements = GURL::Replacements();
-    replacements.SetHost(
-        canonical_name->c_str(),
-        url::Component(0, static_cast<int>(canonical_name->length())));
-    const GURL canonical_url = ctx->request_url.ReplaceComponents(replacements);
-
-    if (!g_brave_browser_process->ad_block_service()->ShouldStartRequest(
-            canonical_url, ctx->resource_type, tab_host, &did_match_exception,
-            &ctx->cancel_request_explicitly, &ctx->mock_data_url)) {
-      ctx->blocked_by = kAdBlocked;
-    }
+    return false;
+  }
+  return !did_match_exception;
+}
+
+void ShouldBlockCanonicalNameOnTaskRunner(
+    std::shared_ptr<BraveRequestInfo> ctx,
+    base::Optional<std::string> canonical_name) {
+  if (!ShouldCheckCanonicalName(ctx, canonical_name)) {
+    return;
+  }
+
+  GURL::Replacements replacements = GURL::Replacements();
+  replacements.SetHost(
+      canonical_name->c_str(),
+      url::Component(0, static_cast<int>(canonical_name->length())));
+  const GURL canonical_url = ctx->request_url.ReplaceComponents(replacements);
+
+  bool did_match_exception = false;
+  std::string tab_host = ctx->tab_origin.host();
+  if (!g_brave_browser_process->ad_block_service()->ShouldStartRequest(
+          canonical_url, ctx->resource_type, tab_host, &did_match_exception,
+          &ctx->cancel_request_explicitly, &ctx->mock_data_url)) {
+    ctx->blocked_by = kAdBlocked;
+  }
+}
+
+void ShouldBlockAdOnTaskRunner(std::shared_ptr<BraveRequestInfo> ctx,
+                               base::Optional<std::string> canonical_name) {
+  if (ShouldBlockAdFirstPassOnTaskRunner(ctx)) {
+    ShouldBlockCanonicalNameOnTaskRunner(ctx, canonical_name);
   }
 }
 
@@ -101,6 +217,75 @@ void ShouldBlockAdWithOptionalCname(
       base::BindOnce(&OnShouldBlockAdResult, next_callback, ctx));
 }
 
+void MaybeCheckCanonicalName(
+    scoped_refptr<base::SequencedTaskRunner> task_runner,
+    const ResponseCallback& next_callback,
+    std::shared_ptr<BraveRequestInfo> ctx,
+    std::shared_ptr<CnameBlockingState> state) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  if (state->done || !state->first_pass_allowed ||
+      !state->canonical_name_resolved) {
+    return;
+  }
+
+  state->done = true;
+
+  if (!ShouldCheckCanonicalName(ctx, state->canonical_name)) {
+    OnShouldBlockAdResult(next_callback, ctx);
+    return;
+  }
+
+  task_runner->PostTaskAndReply(
+      FROM_HERE,
+      base::BindOnce(&ShouldBlockCanonicalNameOnTaskRunner, ctx,
+                     state->canonical_name),
+      base::BindOnce(&OnShouldBlockAdResult, next_callback, ctx));
+}
+
+void OnShouldBlockAdFirstPassResult(
+    scoped_refptr<base::SequencedTaskRunner> task_runner,
+    const ResponseCallback& next_callback,
+    std::shared_ptr<BraveRequestInfo> ctx,
+    std::shared_ptr<CnameBlockingState> state,
+    bool needs_canonical_name) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  DCHECK(!state->done);
+
+  // The original URL was blocked or matched an exception filter, so the
+  // outcome no longer depends on the canonical name.
+  if (!needs_canonical_name) {
+    state->done = true;
+    OnShouldBlockAdResult(next_callback, ctx);
+    return;
+  }
+
+  state->first_pass_allowed = true;
+  MaybeCheckCanonicalName(task_runner, next_callback, ctx, state);
+}
+
+void OnCanonicalNameResolved(
+    scoped_refptr<base::SequencedTaskRunner> task_runner,
+    const ResponseCallback& next_callback,
+    std::shared_ptr<BraveRequestInfo> ctx,
+    std::shared_ptr<CnameBlockingState> state,
+    base::Optional<std::string> cname) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  if (cname.has_value()) {
+    auto* web_contents = GetWebContents(ctx->render_process_id,
+                                        ctx->render_frame_id,
+                                        ctx->frame_tree_node_id);
+    if (web_contents) {
+      CanonicalNameCache::FromBrowserContext(
+          web_contents->GetBrowserContext())
+          ->Put(ctx->network_isolation_key, ctx->request_url.host(), *cname);
+    }
+  }
+
+  state->canonical_name_resolved = true;
+  state->canonical_name = std::move(cname);
+  MaybeCheckCanonicalName(task_runner, next_callback, ctx, state);
+}
+
 class AdblockCnameResolveHostClient : public network::mojom::ResolveHostClient {
  private:
   mojo::Receiver<network::mojom::ResolveHostClient> receiver_{this};
@@ -109,22 +294,16 @@ class AdblockCnameResolveHostClient : public network::mojom::ResolveHostClient {
 
  public:
   AdblockCnameResolveHostClient(
-      const ResponseCallback& next_callback,
-      scoped_refptr<base::SequencedTaskRunner> task_runner,
-      std::shared_ptr<BraveRequestInfo> ctx) {
-    cb_ = base::BindOnce(&ShouldBlockAdWithOptionalCname, task_runner,
-                         std::move(next_callback), ctx);
-
-    auto* web_contents = GetWebContents(
-        ctx->render_process_id, ctx->render_frame_id, ctx->frame_tree_node_id);
-    if (!web_contents) {
+      base::OnceCallback<void(base::Optional<std::string>)> cb,
+      content::BrowserContext* context,
+      std::shared_ptr<BraveRequestInfo> ctx)
+      : cb_(std::move(cb)) {
+    if (!context) {
       start_time_ = base::TimeTicks::Now();
       this->OnComplete(net::ERR_FAILED, net::ResolveErrorInfo(), base::nullopt);
       return;
     }
 
-    content::BrowserContext* context = web_contents->GetBrowserContext();
-
     const auto network_isolation_key = ctx->network_isolation_key;
 
     network::mojom::ResolveHostParametersPtr optional_parameters =
@@ -189,7 +368,45 @@ void OnBeforeURLRequestAdBlockTP(const ResponseCallback& next_callback,
   scoped_refptr<base::SequencedTaskRunner> task_runner =
       g_brave_browser_process->ad_block_service()->GetTaskRunner();
 
-  new AdblockCnameResolveHostClient(std::move(next_callback), task_runner, ctx);
+  auto* web_contents = GetWebContents(
+      ctx->render_process_id, ctx->render_frame_id, ctx->frame_tree_node_id);
+  content::BrowserContext* context =
+      web_contents ? web_contents->GetBrowserContext() : nullptr;
+
+  // A recently resolved canonical name lets both passes run in one task
+  std::string canonical_name;
+  if (context &&
+      CanonicalNameCache::FromBrowserContext(context)->Get(
+          ctx->network_isolation_key, ctx->request_url.host(),
+          &canonical_name)) {
+    ShouldBlockAdWithOptionalCname(task_runner, next_callback, ctx,
+                                   canonical_name);
+    return;
+  }
+
+  // Otherwise match the original URL while the canonical name is resolved,
+  // and only wait for the resolver if the original URL is allowed.
+  auto state = std::make_shared<CnameBlockingState>();
+  task_runner->PostTaskAndReplyWithResult(
+      FROM_HERE, base::BindOnce(&ShouldBlockAdFirstPassOnTaskRunner, ctx),
+      base::BindOnce(&OnShouldBlockAdFirstPassResult, task_runner,
+                     next_callback, ctx, state));
+
+  auto canonical_name_callback = base::BindOnce(
+      &OnCanonicalNameResolved, task_runner, next_callback, ctx, state);
+  if (!GetCanonicalNameResolverForTesting().is_null()) {
+    GetCanonicalNameResolverForTesting().Run(
+        ctx->request_url, std::move(canonical_name_callback));
+    return;
+  }
+
+  new AdblockCnameResolveHostClient(std::move(canonical_name_callback), context,
+                                    ctx);
+}
+
+void SetCanonicalNameResolverForTesting(
+    CanonicalNameResolverForTesting resolver) {
+  GetCanonicalNameResolverForTesting() = std::move(resolver);
 }
 
 int OnBeforeURLRequest_AdBlockTPPreWork(const ResponseCallback& next_callback,
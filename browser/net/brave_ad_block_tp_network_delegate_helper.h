@@ -7,11 +7,24 @@
 #define BRAVE_BROWSER_NET_BRAVE_AD_BLOCK_TP_NETWORK_DELEGATE_HELPER_H_
 
 #include <memory>
+#include <string>
 
+#include "base/callback.h"
+#include "base/optional.h"
 #include "brave/browser/net/url_context.h"
 
 namespace brave {
 
+// Resolves the canonical name of the host of a request URL
+using CanonicalNameResolverForTesting = base::RepeatingCallback<void(
+    const GURL& url,
+    base::OnceCallback<void(base::Optional<std::string>)> callback)>;
+
+// Resolves canonical names with |resolver| rather than the network service.
+// A null callback restores the network service
+void SetCanonicalNameResolverForTesting(
+    CanonicalNameResolverForTesting resolver);
+
 int OnBeforeURLRequest_AdBlockTPPreWork(
     const ResponseCallback& next_callback,
     std::shared_ptr<BraveRequestInfo> ctx);
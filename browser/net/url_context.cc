@@ -17,6 +17,8 @@
 #include "chrome/browser/profiles/profile.h"
 #include "content/public/browser/browser_thread.h"
 #include "net/base/isolation_info.h"
+#include "services/network/public/cpp/resource_request.h"
+#include "services/network/public/cpp/resource_request_body.h"
 
 #if BUILDFLAG(IPFS_ENABLED)
 #include "brave/components/ipfs/pref_names.h"
@@ -27,14 +29,18 @@
 
 namespace brave {
 
-namespace {
+BraveRequestInfo::BraveRequestInfo() = default;
+
+BraveRequestInfo::BraveRequestInfo(const GURL& url) : request_url(url) {}
 
-std::string GetUploadData(const network::ResourceRequest& request) {
+BraveRequestInfo::~BraveRequestInfo() = default;
+
+std::string BraveRequestInfo::GetUploadData() const {
   std::string upload_data;
-  if (!request.request_body) {
+  if (!request_body) {
     return {};
   }
-  const auto* elements = request.request_body->elements();
+  const auto* elements = request_body->elements();
   for (const network::DataElement& element : *elements) {
     if (element.type() == network::mojom::DataElementType::kBytes) {
       upload_data.append(element.bytes(), element.length());
@@ -44,14 +50,6 @@ std::string GetUploadData(const network::ResourceRequest& request) {
   return upload_data;
 }
 
-}  // namespace
-
-BraveRequestInfo::BraveRequestInfo() = default;
-
-BraveRequestInfo::BraveRequestInfo(const GURL& url) : request_url(url) {}
-
-BraveRequestInfo::~BraveRequestInfo() = default;
-
 // static
 std::shared_ptr<brave::BraveRequestInfo> BraveRequestInfo::MakeCTX(
     const network::ResourceRequest& request,
@@ -119,21 +117,26 @@ std::shared_ptr<brave::BraveRequestInfo> BraveRequestInfo::MakeCTX(
 
   Profile* profile = Profile::FromBrowserContext(browser_context);
   auto* map = HostContentSettingsMapFactory::GetForProfile(profile);
-  ctx->allow_brave_shields =
-      brave_shields::GetBraveShieldsEnabled(map, ctx->tab_origin);
-  ctx->allow_ads = brave_shields::GetAdControlType(
-      map, ctx->tab_origin) == brave_shields::ControlType::ALLOW;
+  // Resolved once per tab origin and page rather than for every request
+  const brave_shields::ShieldsSettings shields_settings =
+      brave_shields::BraveShieldsWebContentsObserver::
+          GetShieldsSettingsForFrame(map, ctx->tab_origin,
+                                     ctx->render_process_id,
+                                     ctx->render_frame_id,
+                                     ctx->frame_tree_node_id);
+  ctx->allow_brave_shields = shields_settings.brave_shields_enabled;
+  ctx->allow_ads = shields_settings.allow_ads;
   ctx->allow_http_upgradable_resource =
-      !brave_shields::GetHTTPSEverywhereEnabled(map, ctx->tab_origin);
+      !shields_settings.https_everywhere_enabled;
 
   // HACK: after we fix multiple creations of BraveRequestInfo we should
   // use only tab_origin. Since we recreate BraveRequestInfo during consequent
   // stages of navigation, |tab_origin| changes and so does |allow_referrers|
   // flag, which is not what we want for determining referrers.
-  ctx->allow_referrers = brave_shields::AllowReferrers(
-      map, ctx->redirect_source.is_empty() ? ctx->tab_origin :
-                                             ctx->redirect_source);
-  ctx->upload_data = GetUploadData(request);
+  ctx->allow_referrers = ctx->redirect_source.is_empty() ?
+      shields_settings.allow_referrers :
+      brave_shields::AllowReferrers(map, ctx->redirect_source);
+  ctx->request_body = request.request_body;
 
 #if BUILDFLAG(IPFS_ENABLED)
   auto* prefs = user_prefs::UserPrefs::Get(browser_context);
@@ -10,6 +10,7 @@
 #include <set>
 #include <string>
 
+#include "base/memory/scoped_refptr.h"
 #include "net/base/network_isolation_key.h"
 #include "net/http/http_request_headers.h"
 #include "net/http/http_response_headers.h"
@@ -24,6 +25,7 @@ class BrowserContext;
 }
 
 namespace network {
+class ResourceRequestBody;
 struct ResourceRequest;
 }
 
@@ -110,7 +112,11 @@ struct BraveRequestInfo {
       static_cast<blink::mojom::ResourceType>(-1);
   blink::mojom::ResourceType resource_type = kInvalidResourceType;
 
-  std::string upload_data;
+  // The request body, which is only copied into a string by |GetUploadData|
+  // for the helpers that need it.
+  scoped_refptr<network::ResourceRequestBody> request_body;
+
+  std::string GetUploadData() const;
 
   static std::shared_ptr<brave::BraveRequestInfo>
       MakeCTX(const network::ResourceRequest& request,
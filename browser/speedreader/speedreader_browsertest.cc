@@ -3,8 +3,12 @@
  * License, v. 2.0. If a copy of the MPL was not distributed with this file,
  * You can obtain one at http://mozilla.org/MPL/2.0/. */
 
+#include <string>
+
 #include "base/bind.h"
+#include "base/files/file_util.h"
 #include "base/path_service.h"
+#include "base/threading/thread_restrictions.h"
 #include "brave/app/brave_command_ids.h"
 #include "brave/common/brave_paths.h"
 #include "brave/components/speedreader/features.h"
@@ -15,15 +19,25 @@
 #include "chrome/test/base/ui_test_utils.h"
 #include "components/network_session_configurator/common/network_switches.h"
 #include "content/public/test/browser_test.h"
+#include "content/public/browser/navigation_controller.h"
+#include "content/public/browser/web_contents.h"
 #include "content/public/test/browser_test_utils.h"
+#include "content/public/test/test_navigation_observer.h"
 #include "net/dns/mock_host_resolver.h"
+#include "net/test/embedded_test_server/controllable_http_response.h"
 #include "net/test/embedded_test_server/embedded_test_server.h"
+#include "ui/base/page_transition_types.h"
 
 const char kTestHost[] = "theguardian.com";
 const char kTestPage[] = "/guardian.html";
+const char kTestPageFile[] = "guardian.html";
 const base::FilePath::StringPieceType kTestWhitelist =
     FILE_PATH_LITERAL("speedreader_whitelist.json");
 
+// Smaller than the loader's read buffer, so that the page arrives over many
+// reads which are distilled as they come in.
+constexpr size_t kStreamedChunkSize = 4096;
+
 constexpr char kSpeedreaderToggleUMAHistogramName[] =
     "Brave.SpeedReader.ToggleCount";
 
@@ -94,6 +108,54 @@ IN_PROC_BROWSER_TEST_F(SpeedReaderBrowserTest, DISABLED_SmokeTest) {
   EXPECT_LT(106000, content::EvalJs(rfh, kGetContentLength));
 }
 
+IN_PROC_BROWSER_TEST_F(SpeedReaderBrowserTest, StreamedPageMatchesWholePage) {
+  const char kGetContent[] = "document.documentElement.outerHTML";
+
+  chrome::ExecuteCommand(browser(), IDC_TOGGLE_SPEEDREADER);
+  content::WebContents* contents =
+      browser()->tab_strip_model()->GetActiveWebContents();
+
+  ui_test_utils::NavigateToURL(browser(),
+                               https_server_.GetURL(kTestHost, kTestPage));
+  const std::string whole_page =
+      content::EvalJs(contents->GetMainFrame(), kGetContent).ExtractString();
+
+  std::string page;
+  {
+    base::ScopedAllowBlockingForTesting allow_blocking;
+    base::FilePath test_data_dir;
+    base::PathService::Get(brave::DIR_TEST_DATA, &test_data_dir);
+    ASSERT_TRUE(base::ReadFileToString(
+        test_data_dir.AppendASCII(kTestPageFile), &page));
+  }
+
+  net::EmbeddedTestServer streaming_server(
+      net::EmbeddedTestServer::TYPE_HTTPS);
+  streaming_server.SetSSLConfig(net::EmbeddedTestServer::CERT_OK);
+  net::test_server::ControllableHttpResponse response(&streaming_server,
+                                                      kTestPage);
+  ASSERT_TRUE(streaming_server.Start());
+
+  const GURL url = streaming_server.GetURL(kTestHost, kTestPage);
+  content::TestNavigationObserver observer(contents);
+  contents->GetController().LoadURL(url, content::Referrer(),
+                                    ui::PAGE_TRANSITION_TYPED, std::string());
+  response.WaitForRequest();
+  response.Send(
+      "HTTP/1.1 200 OK\r\n"
+      "Content-Type: text/html; charset=utf-8\r\n"
+      "\r\n");
+  for (size_t offset = 0; offset < page.size(); offset += kStreamedChunkSize)
+    response.Send(page.substr(offset, kStreamedChunkSize));
+  response.Done();
+  observer.Wait();
+
+  // Distilling a page fed in pieces must give the same result as when it is
+  // read in whole buffers.
+  EXPECT_EQ(whole_page,
+            content::EvalJs(contents->GetMainFrame(), kGetContent));
+}
+
 IN_PROC_BROWSER_TEST_F(SpeedReaderBrowserTest, P3ATest) {
   base::HistogramTester tester;
 
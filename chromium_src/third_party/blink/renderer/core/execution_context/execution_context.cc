@@ -22,44 +22,17 @@
 #include "third_party/blink/renderer/platform/network/network_utils.h"
 #include "third_party/blink/renderer/platform/supplementable.h"
 #include "third_party/blink/renderer/platform/wtf/text/string_builder.h"
-
-namespace {
-
-const uint64_t zero = 0;
-
-inline uint64_t lfsr_next(uint64_t v) {
-  return ((v >> 1) | (((v << 62) ^ (v << 61)) & (~(~zero << 63) << 62)));
-}
-
-float Identity(float value, size_t index) {
-  return value;
-}
-
-float ConstantMultiplier(double fudge_factor, float value, size_t index) {
-  return value * fudge_factor;
-}
-
-float PseudoRandomSequence(uint64_t seed, float value, size_t index) {
-  static uint64_t v;
-  const double maxUInt64AsDouble = UINT64_MAX;
-  if (index == 0) {
-    // start of loop, reset to initial seed which was passed in and is based on
-    // the domain key
-    v = seed;
-  }
-  // get next value in PRNG sequence
-  v = lfsr_next(v);
-  // return pseudo-random float between 0 and 0.1
-  return (v / maxUInt64AsDouble) / 10;
-}
-
-}  // namespace
+#include "third_party/skia/include/core/SkImage.h"
 
 namespace brave {
 
 const char kBraveSessionToken[] = "brave_session_token";
 const char BraveSessionCache::kSupplementName[] = "BraveSessionCache";
 const int kFarbledUserAgentMaxExtraSpaces = 5;
+const wtf_size_t kMaxPerturbedImages = 4;
+// Perturbed images are kept alive for the lifetime of the execution context,
+// so bound the RGBA bytes they may hold; larger canvases are never cached.
+const size_t kMaxPerturbedImagesBytes = 16 * 1024 * 1024;
 
 // acceptable letters for generating random strings
 const char kLettersForRandomStrings[] =
@@ -130,7 +103,7 @@ BraveSessionCache& BraveSessionCache::From(ExecutionContext& context) {
   return *cache;
 }
 
-AudioFarblingCallback BraveSessionCache::GetAudioFarblingCallback(
+AudioFarbler BraveSessionCache::GetAudioFarbler(
     blink::WebContentSettingsClient* settings) {
   if (farbling_enabled_ && settings) {
     switch (settings->GetBraveFarblingLevel()) {
@@ -143,15 +116,15 @@ AudioFarblingCallback BraveSessionCache::GetAudioFarblingCallback(
         double fudge_factor = 0.99 + ((*fudge / maxUInt64AsDouble) / 100);
         VLOG(1) << "audio fudge factor (based on session token) = "
                 << fudge_factor;
-        return base::BindRepeating(&ConstantMultiplier, fudge_factor);
+        return AudioFarbler::ConstantMultiplier(fudge_factor);
       }
       case BraveFarblingLevel::MAXIMUM: {
         uint64_t seed = *reinterpret_cast<uint64_t*>(domain_key_);
-        return base::BindRepeating(&PseudoRandomSequence, seed);
+        return AudioFarbler::PseudoRandomSequence(seed);
       }
     }
   }
-  return base::BindRepeating(&Identity);
+  return AudioFarbler();
 }
 
 scoped_refptr<blink::StaticBitmapImage> BraveSessionCache::PerturbPixels(
@@ -179,6 +152,19 @@ BraveSessionCache::PerturbPixelsInternal(
   DCHECK(image_bitmap);
   if (image_bitmap->IsNull())
     return image_bitmap;
+  const sk_sp<SkImage> source_image =
+      image_bitmap->PaintImageForCurrentFrame().GetSkImage();
+  const uint32_t source_id = source_image ? source_image->uniqueID() : 0;
+  if (source_id) {
+    for (wtf_size_t i = 0; i < perturbed_images_.size(); ++i) {
+      if (perturbed_images_[i].source_id != source_id)
+        continue;
+      const PerturbedImage perturbed_image = perturbed_images_[i];
+      perturbed_images_.EraseAt(i);
+      perturbed_images_.push_front(perturbed_image);
+      return perturbed_image.image;
+    }
+  }
   // convert to an ImageDataBuffer to normalize the pixel data to RGBA, 4 bytes
   // per pixel
   std::unique_ptr<blink::ImageDataBuffer> data_buffer =
@@ -217,10 +203,28 @@ BraveSessionCache::PerturbPixelsInternal(
       v = lfsr_next(v);
     }
   }
-  // convert back to a StaticBitmapImage to return to the caller
-  scoped_refptr<blink::StaticBitmapImage> perturbed_bitmap =
-      blink::UnacceleratedStaticBitmapImage::Create(
-          data_buffer->RetainedImage());
+  scoped_refptr<blink::StaticBitmapImage> perturbed_bitmap;
+  if (source_image && data_buffer->RetainedImage() == source_image) {
+    // The buffer wraps the pixels of an unaccelerated source directly, so
+    // they have been perturbed in place and the source can be returned as is.
+    perturbed_bitmap = image_bitmap;
+  } else {
+    // convert back to a StaticBitmapImage to return to the caller
+    perturbed_bitmap = blink::UnacceleratedStaticBitmapImage::Create(
+        data_buffer->RetainedImage());
+  }
+  const size_t byte_count = 4 * pixel_count;
+  if (source_id && byte_count <= kMaxPerturbedImagesBytes) {
+    while (!perturbed_images_.IsEmpty() &&
+           (perturbed_images_.size() == kMaxPerturbedImages ||
+            perturbed_images_bytes_ + byte_count > kMaxPerturbedImagesBytes)) {
+      perturbed_images_bytes_ -= perturbed_images_.back().byte_count;
+      perturbed_images_.pop_back();
+    }
+    perturbed_images_.push_front(
+        PerturbedImage{source_id, byte_count, perturbed_bitmap});
+    perturbed_images_bytes_ += byte_count;
+  }
   return perturbed_bitmap;
 }
 
@@ -10,7 +10,8 @@
 
 #include <random>
 
-#include "base/callback.h"
+#include "brave/third_party/blink/renderer/brave_audio_farbler.h"
+#include "third_party/blink/renderer/platform/wtf/vector.h"
 
 namespace blink {
 class StaticBitmapImage;
@@ -27,8 +28,6 @@ using blink::TraceTrait;
 
 namespace brave {
 
-typedef base::RepeatingCallback<float(float, size_t)> AudioFarblingCallback;
-
 CORE_EXPORT blink::WebContentSettingsClient* GetContentSettingsClientFor(
     ExecutionContext* context);
 
@@ -43,8 +42,7 @@ class CORE_EXPORT BraveSessionCache final
 
   static BraveSessionCache& From(ExecutionContext&);
 
-  AudioFarblingCallback GetAudioFarblingCallback(
-      blink::WebContentSettingsClient* settings);
+  AudioFarbler GetAudioFarbler(blink::WebContentSettingsClient* settings);
   scoped_refptr<blink::StaticBitmapImage> PerturbPixels(
       blink::WebContentSettingsClient* settings,
       scoped_refptr<blink::StaticBitmapImage> image_bitmap);
@@ -53,9 +51,22 @@ class CORE_EXPORT BraveSessionCache final
   std::mt19937_64 MakePseudoRandomGenerator();
 
  private:
+  struct PerturbedImage {
+    uint32_t source_id;
+    size_t byte_count;
+    scoped_refptr<blink::StaticBitmapImage> image;
+  };
+
   bool farbling_enabled_;
   uint64_t session_key_;
   uint8_t domain_key_[32];
+  // Most recently perturbed images first, keyed by the unique ID of the
+  // source SkImage. SkImages are immutable, so an unchanged canvas keeps
+  // returning the same ID and its perturbed copy can be handed out again
+  // without reading back and hashing the pixels.
+  WTF::Vector<PerturbedImage> perturbed_images_;
+  // Total size of the pixels held by |perturbed_images_|.
+  size_t perturbed_images_bytes_ = 0;
 
   scoped_refptr<blink::StaticBitmapImage> PerturbPixelsInternal(
       scoped_refptr<blink::StaticBitmapImage> image_bitmap);
@@ -545,6 +545,8 @@ void AdsServiceImpl::Shutdown() {
 
   idle_poll_timer_.Stop();
 
+  bat_ads_pref_change_registrar_.RemoveAll();
+
   bat_ads_.reset();
   bat_ads_client_receiver_.reset();
   bat_ads_service_.reset();
@@ -623,6 +625,8 @@ void AdsServiceImpl::OnMigrateConfirmationsState(
 }
 
 void AdsServiceImpl::Initialize() {
+  bat_ads_pref_change_registrar_.Init(profile_->GetPrefs());
+
   profile_pref_change_registrar_.Init(profile_->GetPrefs());
 
   profile_pref_change_registrar_.Add(ads::prefs::kEnabled,
@@ -1954,6 +1958,8 @@ void AdsServiceImpl::Log(
 
 bool AdsServiceImpl::GetBooleanPref(
     const std::string& path) const {
+  ObservePref(path);
+
   const base::Value* value = prefs::GetValue(profile_->GetPrefs(), path);
   if (!value) {
     return false;
@@ -1968,10 +1974,14 @@ void AdsServiceImpl::SetBooleanPref(
     const std::string& path,
     const bool value) {
   profile_->GetPrefs()->SetBoolean(path, value);
+
+  ObservePref(path);
 }
 
 int AdsServiceImpl::GetIntegerPref(
     const std::string& path) const {
+  ObservePref(path);
+
   const base::Value* value = prefs::GetValue(profile_->GetPrefs(), path);
   if (!value) {
     return 0;
@@ -1986,10 +1996,14 @@ void AdsServiceImpl::SetIntegerPref(
     const std::string& path,
     const int value) {
   profile_->GetPrefs()->SetInteger(path, value);
+
+  ObservePref(path);
 }
 
 double AdsServiceImpl::GetDoublePref(
     const std::string& path) const {
+  ObservePref(path);
+
   const base::Value* value = prefs::GetValue(profile_->GetPrefs(), path);
   if (!value) {
     return 0.0;
@@ -2004,10 +2018,14 @@ void AdsServiceImpl::SetDoublePref(
     const std::string& path,
     const double value) {
   profile_->GetPrefs()->SetDouble(path, value);
+
+  ObservePref(path);
 }
 
 std::string AdsServiceImpl::GetStringPref(
     const std::string& path) const {
+  ObservePref(path);
+
   const base::Value* value = prefs::GetValue(profile_->GetPrefs(), path);
   if (!value) {
     return "";
@@ -2022,10 +2040,14 @@ void AdsServiceImpl::SetStringPref(
     const std::string& path,
     const std::string& value) {
   profile_->GetPrefs()->SetString(path, value);
+
+  ObservePref(path);
 }
 
 int64_t AdsServiceImpl::GetInt64Pref(
     const std::string& path) const {
+  ObservePref(path);
+
   const base::Value* value = prefs::GetValue(profile_->GetPrefs(), path);
   if (!value) {
     return 0;
@@ -2044,10 +2066,14 @@ void AdsServiceImpl::SetInt64Pref(
     const std::string& path,
     const int64_t value) {
   profile_->GetPrefs()->SetInt64(path, value);
+
+  ObservePref(path);
 }
 
 uint64_t AdsServiceImpl::GetUint64Pref(
     const std::string& path) const {
+  ObservePref(path);
+
   const base::Value* value = prefs::GetValue(profile_->GetPrefs(), path);
   if (!value) {
     return 0;
@@ -2066,6 +2092,8 @@ void AdsServiceImpl::SetUint64Pref(
     const std::string& path,
     const uint64_t value) {
   profile_->GetPrefs()->SetUint64(path, value);
+
+  ObservePref(path);
 }
 
 void AdsServiceImpl::ClearPref(
@@ -2073,6 +2101,29 @@ void AdsServiceImpl::ClearPref(
   profile_->GetPrefs()->ClearPref(path);
 }
 
+void AdsServiceImpl::ObservePref(
+    const std::string& path) const {
+  // Observed once bat ads has either read or written a pref, as both populate
+  // its cache. Prefs are also read by the browser before bat ads is started
+  if (!bat_ads_.is_bound() ||
+      bat_ads_pref_change_registrar_.IsObserved(path)) {
+    return;
+  }
+
+  bat_ads_pref_change_registrar_.Add(path,
+      base::BindRepeating(&AdsServiceImpl::OnBatAdsPrefChanged,
+          base::Unretained(this)));
+}
+
+void AdsServiceImpl::OnBatAdsPrefChanged(
+    const std::string& path) const {
+  if (!bat_ads_.is_bound()) {
+    return;
+  }
+
+  bat_ads_->OnPrefChanged(path);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 void AdsServiceImpl::OnBackground() {
@@ -460,6 +460,13 @@ class AdsServiceImpl : public AdsService,
   void ClearPref(
       const std::string& path) override;
 
+  // bat ads caches the prefs it reads and writes, so tell it when one of them
+  // changes
+  void ObservePref(
+      const std::string& path) const;
+  void OnBatAdsPrefChanged(
+      const std::string& path) const;
+
   // BackgroundHelper::Observer implementation
   void OnBackground() override;
   void OnForeground() override;
@@ -491,6 +498,10 @@ class AdsServiceImpl : public AdsService,
 
   PrefChangeRegistrar profile_pref_change_registrar_;
 
+  // Observes the prefs read by bat ads. Mutable as it is updated from the
+  // const pref getters
+  mutable PrefChangeRegistrar bat_ads_pref_change_registrar_;
+
   base::flat_set<network::SimpleURLLoader*> url_loaders_;
 
   NotificationDisplayService* display_service_;  // NOT OWNED
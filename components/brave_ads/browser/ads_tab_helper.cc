@@ -27,6 +27,15 @@
 
 namespace brave_ads {
 
+namespace {
+
+// Only the leading text of a page is needed to classify it, so cap the text
+// in the renderer rather than copying the whole document across IPC
+const char kPageTextScript[] =
+    "document.body.innerText.substring(0, 65536)";
+
+}  // namespace
+
 AdsTabHelper::AdsTabHelper(content::WebContents* web_contents)
     : WebContentsObserver(web_contents),
       tab_id_(sessions::SessionTabHelper::IdForTab(web_contents)),
@@ -78,7 +87,7 @@ void AdsTabHelper::RunIsolatedJavaScript(
   DCHECK(render_frame_host);
 
   dom_distiller::RunIsolatedJavaScript(render_frame_host,
-      "document.body.innerText",
+      kPageTextScript,
           base::BindOnce(&AdsTabHelper::OnJavaScriptResult,
               weak_factory_.GetWeakPtr()));
 }
@@ -12,6 +12,7 @@
 #include <vector>
 
 #include "base/files/file_path.h"
+#include "base/files/memory_mapped_file.h"
 
 namespace brave_component_updater {
 
@@ -20,6 +21,8 @@ using DATFileDataBuffer = std::vector<unsigned char>;
 void GetDATFileData(const base::FilePath& file_path,
                     DATFileDataBuffer* buffer);
 std::string GetDATFileAsString(const base::FilePath& file_path);
+bool MapDATFile(const base::FilePath& file_path,
+                base::MemoryMappedFile* dat_file);
 
 template<typename T>
 using LoadDATFileDataResult =
@@ -41,6 +44,23 @@ LoadDATFileDataResult<T> LoadDATFileData(
       std::move(client), std::move(buffer));
 }
 
+// Deserializes straight from a read-only mapping of |dat_file_path| instead of
+// copying the file into a DATFileDataBuffer first. Only use this for types
+// which do not keep pointers into the data after deserialize() returns; the
+// mapping is released as soon as it does.
+template<typename T>
+std::unique_ptr<T> LoadMappedDATFileData(const base::FilePath& dat_file_path) {
+  base::MemoryMappedFile dat_file;
+  if (!MapDATFile(dat_file_path, &dat_file))
+    return nullptr;
+
+  std::unique_ptr<T> client = std::make_unique<T>();
+  if (!client->deserialize(reinterpret_cast<char*>(dat_file.data()),
+          dat_file.length()))
+    client.reset();
+
+  return client;
+}
 
 }  // namespace brave_component_updater
 
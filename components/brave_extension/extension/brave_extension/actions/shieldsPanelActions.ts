@@ -32,6 +32,13 @@ export const resourceBlocked: actions.ResourceBlocked = (details) => {
   }
 }
 
+export const resourcesBlocked: actions.ResourcesBlocked = (details) => {
+  return {
+    type: types.RESOURCES_BLOCKED,
+    details
+  }
+}
+
 export const blockAdsTrackers: actions.BlockAdsTrackers = (setting) => {
   return {
     type: types.BLOCK_ADS_TRACKERS,
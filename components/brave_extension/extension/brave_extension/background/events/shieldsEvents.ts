@@ -3,12 +3,15 @@
  * You can obtain one at http://mozilla.org/MPL/2.0/. */
 
 import actions from '../actions/shieldsPanelActions'
-import { BlockDetails } from '../../types/actions/shieldsPanelActions'
+import { BlockDetails, BlockedResourcesDetails } from '../../types/actions/shieldsPanelActions'
 
 if (chrome.braveShields) {
   chrome.braveShields.onBlocked.addListener((detail: BlockDetails) => {
     actions.resourceBlocked(detail)
   })
+  chrome.braveShields.onBlockedResources.addListener((details: BlockedResourcesDetails) => {
+    actions.resourcesBlocked(details)
+  })
 } else {
   console.log('chrome.braveShields not enabled')
 }
@@ -13,6 +13,7 @@ import * as settingsTypes from '../../constants/settingsTypes'
 import * as webNavigationTypes from '../../constants/webNavigationTypes'
 import { State, PersistentData } from '../../types/state/shieldsPannelState'
 import { Actions } from '../../types/actions/index'
+import { BlockedResource } from '../../types/actions/shieldsPanelActions'
 import { SettingsData } from '../../types/other/settingsTypes'
 
 // State helpers
@@ -47,6 +48,25 @@ import { getAllowedScriptsOrigins } from '../../helpers/noScriptUtils'
 import { areObjectsEqual } from '../../helpers/objectUtils'
 import { getHostname } from '../../helpers/urlUtils'
 
+const updateResourcesBlocked = (
+  state: State,
+  tabId: number,
+  resources: BlockedResource[]
+): State => {
+  for (const resource of resources) {
+    state = shieldsPanelState.updateResourceBlocked(
+      state, tabId, resource.blockType, resource.subresource)
+  }
+  // Update the badge once for the whole batch
+  if (tabId === shieldsPanelState.getActiveTabId(state)) {
+    const isShieldsActive: boolean = shieldsPanelState.isShieldsActive(state, tabId)
+    if (isShieldsActive) {
+      shieldsPanelState.updateShieldsIconBadgeText(state)
+    }
+  }
+  return state
+}
+
 export default function shieldsPanelReducer (
   state: State = {
     persistentData: storageAPI.loadPersistentData(),
@@ -185,16 +205,15 @@ export default function shieldsPanelReducer (
       break
     }
     case shieldsPanelTypes.RESOURCE_BLOCKED: {
-      const tabId: number = action.details.tabId
-      const currentTabId: number = shieldsPanelState.getActiveTabId(state)
-      state = shieldsPanelState.updateResourceBlocked(
-        state, tabId, action.details.blockType, action.details.subresource)
-      if (tabId === currentTabId) {
-        const isShieldsActive: boolean = shieldsPanelState.isShieldsActive(state, tabId)
-        if (isShieldsActive) {
-          shieldsPanelState.updateShieldsIconBadgeText(state)
-        }
-      }
+      state = updateResourcesBlocked(state, action.details.tabId, [{
+        blockType: action.details.blockType,
+        subresource: action.details.subresource
+      }])
+      break
+    }
+    case shieldsPanelTypes.RESOURCES_BLOCKED: {
+      state = updateResourcesBlocked(
+        state, action.details.tabId, action.details.resources)
       break
     }
     case shieldsPanelTypes.BLOCK_ADS_TRACKERS: {
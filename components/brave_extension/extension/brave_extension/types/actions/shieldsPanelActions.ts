@@ -24,6 +24,16 @@ export interface BlockDetails {
   subresource: string
 }
 
+export interface BlockedResource {
+  blockType: BlockTypes
+  subresource: string
+}
+
+export interface BlockedResourcesDetails {
+  tabId: number
+  resources: BlockedResource[]
+}
+
 interface ShieldsPanelDataUpdatedReturn {
   type: types.SHIELDS_PANEL_DATA_UPDATED
   details: ShieldDetails
@@ -59,6 +69,15 @@ export interface ResourceBlocked {
   (details: BlockDetails): ResourceBlockedReturn
 }
 
+interface ResourcesBlockedReturn {
+  type: types.RESOURCES_BLOCKED
+  details: BlockedResourcesDetails
+}
+
+export interface ResourcesBlocked {
+  (details: BlockedResourcesDetails): ResourcesBlockedReturn
+}
+
 interface BlockAdsTrackersReturn {
   type: types.BLOCK_ADS_TRACKERS
   setting: BlockOptions
@@ -213,6 +232,7 @@ export type shieldPanelActions =
   ShieldsToggledReturn |
   ReportBrokenSiteReturn |
   ResourceBlockedReturn |
+  ResourcesBlockedReturn |
   BlockAdsTrackersReturn |
   ControlsToggledReturn |
   HttpsEverywhereToggledReturn |
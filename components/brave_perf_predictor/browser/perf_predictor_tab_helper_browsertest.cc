@@ -13,6 +13,7 @@
 #include "brave/components/brave_perf_predictor/common/pref_names.h"
 #include "brave/components/brave_shields/browser/ad_block_custom_filters_service.h"
 #include "brave/components/brave_shields/browser/ad_block_service.h"
+#include "brave/components/brave_shields/browser/brave_shields_web_contents_observer.h"
 #include "chrome/browser/profiles/profile.h"
 #include "chrome/browser/ui/browser.h"
 #include "chrome/test/base/in_process_browser_test.h"
@@ -46,6 +47,14 @@ class PerfPredictorTabHelperTest : public InProcessBrowserTest {
   void SetUpOnMainThread() override {
     InProcessBrowserTest::SetUpOnMainThread();
     host_resolver()->AddRule("*", "127.0.0.1");
+    brave_shields::BraveShieldsWebContentsObserver::
+        SetDispatchImmediatelyForTesting(true);
+  }
+
+  void TearDownOnMainThread() override {
+    brave_shields::BraveShieldsWebContentsObserver::
+        SetDispatchImmediatelyForTesting(false);
+    InProcessBrowserTest::TearDownOnMainThread();
   }
 
   void SetUp() override {
@@ -59,6 +68,17 @@ class PerfPredictorTabHelperTest : public InProcessBrowserTest {
     ASSERT_TRUE(g_brave_browser_process->ad_block_service()->IsInitialized());
   }
 
+  void WaitForCustomFiltersCompiled() {
+    scoped_refptr<base::ThreadTestHelper> compile_helper(
+        new base::ThreadTestHelper(
+            g_brave_browser_process->ad_block_custom_filters_service()
+                ->GetCompileTaskRunnerForTesting()));
+    ASSERT_TRUE(compile_helper->Run());
+    scoped_refptr<base::ThreadTestHelper> tr_helper(new base::ThreadTestHelper(
+        g_brave_browser_process->local_data_files_service()->GetTaskRunner()));
+    ASSERT_TRUE(tr_helper->Run());
+  }
+
   void TearDown() override { InProcessBrowserTest::TearDown(); }
 
   void InitEmbeddedTestServer() {
@@ -91,6 +111,7 @@ IN_PROC_BROWSER_TEST_F(PerfPredictorTabHelperTest, NoBlockNoSavings) {
 IN_PROC_BROWSER_TEST_F(PerfPredictorTabHelperTest, ScriptBlockHasSavings) {
   ASSERT_TRUE(g_brave_browser_process->ad_block_custom_filters_service()
                   ->UpdateCustomFilters("*analytics.js"));
+  WaitForCustomFiltersCompiled();
   EXPECT_EQ(getProfileBandwidthSaved(browser()), 0ULL);
 
   GURL url = embedded_test_server()->GetURL("/blocking.html");
@@ -112,6 +133,7 @@ IN_PROC_BROWSER_TEST_F(PerfPredictorTabHelperTest, ScriptBlockHasSavings) {
 IN_PROC_BROWSER_TEST_F(PerfPredictorTabHelperTest, NewNavigationStoresSavings) {
   ASSERT_TRUE(g_brave_browser_process->ad_block_custom_filters_service()
                   ->UpdateCustomFilters("*analytics.js"));
+  WaitForCustomFiltersCompiled();
   EXPECT_EQ(getProfileBandwidthSaved(browser()), 0ULL);
 
   GURL url = embedded_test_server()->GetURL("/blocking.html");
@@ -372,6 +372,7 @@ void RewardsServiceImpl::Init(
 }
 
 void RewardsServiceImpl::InitPrefChangeRegistrar() {
+  state_pref_change_registrar_.Init(profile_->GetPrefs());
   profile_pref_change_registrar_.Init(profile_->GetPrefs());
   profile_pref_change_registrar_.Add(
       prefs::kInlineTipTwitterEnabled,
@@ -1416,6 +1417,7 @@ void RewardsServiceImpl::Reset() {
   }
 
   current_media_fetchers_.clear();
+  state_pref_change_registrar_.RemoveAll();
   bat_ledger_.reset();
   bat_ledger_client_receiver_.reset();
   bat_ledger_service_.reset();
@@ -1429,51 +1431,63 @@ void RewardsServiceImpl::Reset() {
 
 void RewardsServiceImpl::SetBooleanState(const std::string& name, bool value) {
   profile_->GetPrefs()->SetBoolean(GetPrefPath(name), value);
+  ObserveState(name);
 }
 
 bool RewardsServiceImpl::GetBooleanState(const std::string& name) const {
+  ObserveState(name);
   return profile_->GetPrefs()->GetBoolean(GetPrefPath(name));
 }
 
 void RewardsServiceImpl::SetIntegerState(const std::string& name, int value) {
   profile_->GetPrefs()->SetInteger(GetPrefPath(name), value);
+  ObserveState(name);
 }
 
 int RewardsServiceImpl::GetIntegerState(const std::string& name) const {
+  ObserveState(name);
   return profile_->GetPrefs()->GetInteger(GetPrefPath(name));
 }
 
 void RewardsServiceImpl::SetDoubleState(const std::string& name, double value) {
   profile_->GetPrefs()->SetDouble(GetPrefPath(name), value);
+  ObserveState(name);
 }
 
 double RewardsServiceImpl::GetDoubleState(const std::string& name) const {
+  ObserveState(name);
   return profile_->GetPrefs()->GetDouble(GetPrefPath(name));
 }
 
 void RewardsServiceImpl::SetStringState(const std::string& name,
                                         const std::string& value) {
   profile_->GetPrefs()->SetString(GetPrefPath(name), value);
+  ObserveState(name);
 }
 
 std::string RewardsServiceImpl::GetStringState(const std::string& name) const {
+  ObserveState(name);
   return profile_->GetPrefs()->GetString(GetPrefPath(name));
 }
 
 void RewardsServiceImpl::SetInt64State(const std::string& name, int64_t value) {
   profile_->GetPrefs()->SetInt64(GetPrefPath(name), value);
+  ObserveState(name);
 }
 
 int64_t RewardsServiceImpl::GetInt64State(const std::string& name) const {
+  ObserveState(name);
   return profile_->GetPrefs()->GetInt64(GetPrefPath(name));
 }
 
 void RewardsServiceImpl::SetUint64State(const std::string& name,
                                         uint64_t value) {
   profile_->GetPrefs()->SetUint64(GetPrefPath(name), value);
+  ObserveState(name);
 }
 
 uint64_t RewardsServiceImpl::GetUint64State(const std::string& name) const {
+  ObserveState(name);
   return profile_->GetPrefs()->GetUint64(GetPrefPath(name));
 }
 
@@ -1481,6 +1495,25 @@ void RewardsServiceImpl::ClearState(const std::string& name) {
   profile_->GetPrefs()->ClearPref(GetPrefPath(name));
 }
 
+void RewardsServiceImpl::ObserveState(const std::string& name) const {
+  const std::string path = GetPrefPath(name);
+  if (state_pref_change_registrar_.IsObserved(path)) {
+    return;
+  }
+
+  state_pref_change_registrar_.Add(path,
+      base::BindRepeating(&RewardsServiceImpl::OnStateChanged,
+          base::Unretained(this), name));
+}
+
+void RewardsServiceImpl::OnStateChanged(const std::string& name) const {
+  if (!Connected()) {
+    return;
+  }
+
+  bat_ledger_->OnStateChanged(name);
+}
+
 bool RewardsServiceImpl::GetBooleanOption(const std::string& name) const {
   DCHECK(!name.empty());
 
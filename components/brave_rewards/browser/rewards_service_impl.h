@@ -619,6 +619,11 @@ class RewardsServiceImpl : public RewardsService,
   uint64_t GetUint64State(const std::string& name) const override;
   void ClearState(const std::string& name) override;
 
+  // The ledger caches the state it reads and writes, so tell it when a value
+  // changes
+  void ObserveState(const std::string& name) const;
+  void OnStateChanged(const std::string& name) const;
+
   bool GetBooleanOption(const std::string& name) const override;
   int GetIntegerOption(const std::string& name) const override;
   double GetDoubleOption(const std::string& name) const override;
@@ -780,6 +785,9 @@ class RewardsServiceImpl : public RewardsService,
   std::unique_ptr<base::OneShotTimer> notification_startup_timer_;
   std::unique_ptr<base::RepeatingTimer> notification_periodic_timer_;
   PrefChangeRegistrar profile_pref_change_registrar_;
+  // Observes the state read by the ledger process. Mutable as it is updated
+  // from the const state getters
+  mutable PrefChangeRegistrar state_pref_change_registrar_;
 
   uint32_t next_timer_id_;
   bool reset_states_;
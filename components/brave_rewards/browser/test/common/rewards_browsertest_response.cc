@@ -258,6 +258,14 @@ void RewardsBrowserTestResponse::Get(
     return;
   }
 
+  if (url.find("/v1/suggestions") != std::string::npos) {
+    if (suggestions_failure_count_ > 0) {
+      suggestions_failure_count_--;
+      *response_status_code = net::HTTP_INTERNAL_SERVER_ERROR;
+    }
+    return;
+  }
+
   if (url.find("/v1/captchas") != std::string::npos) {
     *response = captcha_;
   }
@@ -366,4 +374,12 @@ void RewardsBrowserTestResponse::SetUserFundsBalance(const bool user_funds) {
   user_funds_balance_ = user_funds;
 }
 
+void RewardsBrowserTestResponse::SetSuggestionsFailureCount(const int count) {
+  suggestions_failure_count_ = count;
+}
+
+int RewardsBrowserTestResponse::GetSuggestionsFailureCount() const {
+  return suggestions_failure_count_;
+}
+
 }  // namespace rewards_browsertest
@@ -52,6 +52,11 @@ class RewardsBrowserTestResponse {
 
   void SetUserFundsBalance(const bool user_funds);
 
+  // Fails the next |count| token redemption requests
+  void SetSuggestionsFailureCount(const int count);
+
+  int GetSuggestionsFailureCount() const;
+
  private:
   std::string wallet_;
   std::string promotions_;
@@ -76,6 +81,7 @@ class RewardsBrowserTestResponse {
   bool verified_wallet_ = false;
   std::string external_balance_ = "0.0";
   bool user_funds_balance_ = false;
+  int suggestions_failure_count_ = 0;
   std::map<std::string, std::string> publisher_prefixes_;
 };
 
@@ -206,6 +206,60 @@ IN_PROC_BROWSER_TEST_F(
   }
 }
 
+IN_PROC_BROWSER_TEST_F(
+    RewardsContributionBrowserTest,
+    AutoContributionMultiplePublishersRetriesFailedRedemptions) {
+  response_->SetSuggestionsFailureCount(2);
+  rewards_browsertest_util::StartProcess(rewards_service_);
+  rewards_browsertest_util::CreateWallet(rewards_service_);
+  rewards_service_->SetAutoContributeEnabled(true);
+  context_helper_->LoadURL(rewards_browsertest_util::GetRewardsUrl());
+  contribution_->AddBalance(promotion_->ClaimPromotionViaCode());
+
+  context_helper_->VisitPublisher(
+      rewards_browsertest_util::GetUrl(https_server_.get(), "duckduckgo.com"),
+      true);
+  context_helper_->VisitPublisher(
+      rewards_browsertest_util::GetUrl(
+          https_server_.get(),
+          "laurenwags.github.io"),
+      true);
+  context_helper_->VisitPublisher(
+      rewards_browsertest_util::GetUrl(https_server_.get(), "site1.com"),
+      true);
+
+  rewards_service_->StartMonthlyContributionForTest();
+
+  contribution_->WaitForACReconcileCompleted();
+  ASSERT_EQ(contribution_->GetACStatus(), ledger::type::Result::LEDGER_OK);
+
+  // Both failed redemptions were hit and then retried
+  EXPECT_EQ(response_->GetSuggestionsFailureCount(), 0);
+
+  contribution_->IsBalanceCorrect();
+
+  rewards_browsertest_util::WaitForElementToContain(
+      contents(),
+      "[color=contribute]",
+      "-20.000BAT");
+
+  context_helper_->LoadURL(rewards_browsertest_util::GetRewardsInternalsUrl());
+
+  rewards_browsertest_util::WaitForElementThenClick(
+      contents(),
+      "#internals-tabs > div > div:nth-of-type(4)");
+
+  for (int i = 1; i <= 3; i++) {
+    const std::string query = base::StringPrintf(
+        "[data-test-id='publisher-wrapper'] > div:nth-of-type(%d) "
+        "[data-test-id='contributed-amount']",
+        i);
+    EXPECT_NE(
+      rewards_browsertest_util::WaitForElementThenGetContent(contents(), query),
+      "0 BAT");
+  }
+}
+
 IN_PROC_BROWSER_TEST_F(
     RewardsContributionBrowserTest,
     AutoContributionMultiplePublishersUphold) {
@@ -5,7 +5,13 @@
 
 #include "brave/components/brave_shields/browser/ad_block_custom_filters_service.h"
 
+#include <utility>
+
+#include "base/bind.h"
 #include "base/logging.h"
+#include "base/metrics/histogram_macros.h"
+#include "base/task/post_task.h"
+#include "base/timer/elapsed_timer.h"
 #include "brave/browser/brave_browser_process_impl.h"
 #include "brave/common/pref_names.h"
 #include "brave/components/brave_shields/browser/ad_block_service.h"
@@ -18,7 +24,11 @@ using brave_component_updater::BraveComponent;
 namespace brave_shields {
 
 AdBlockCustomFiltersService::AdBlockCustomFiltersService(
-    BraveComponent::Delegate* delegate) : AdBlockBaseService(delegate) {
+    BraveComponent::Delegate* delegate)
+    : AdBlockBaseService(delegate),
+      compile_task_runner_(base::CreateSequencedTaskRunner(
+          {base::ThreadPool(), base::TaskPriority::USER_VISIBLE,
+           base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN})) {
 }
 
 AdBlockCustomFiltersService::~AdBlockCustomFiltersService() {
@@ -44,19 +54,48 @@ bool AdBlockCustomFiltersService::UpdateCustomFilters(
     return false;
   local_state->SetString(kAdBlockCustomFilters, custom_filters);
 
-  GetTaskRunner()->PostTask(
+  compile_task_runner_->PostTask(
       FROM_HERE,
       base::BindOnce(
-          &AdBlockCustomFiltersService::UpdateCustomFiltersOnFileTaskRunner,
+          &AdBlockCustomFiltersService::CompileCustomFiltersOnCompileTaskRunner,
           base::Unretained(this), custom_filters));
 
   return true;
 }
 
-void AdBlockCustomFiltersService::UpdateCustomFiltersOnFileTaskRunner(
+scoped_refptr<base::SequencedTaskRunner>
+AdBlockCustomFiltersService::GetCompileTaskRunnerForTesting() {
+  return compile_task_runner_;
+}
+
+void AdBlockCustomFiltersService::CompileCustomFiltersOnCompileTaskRunner(
     const std::string& custom_filters) {
+  DCHECK(compile_task_runner_->RunsTasksInCurrentSequence());
+  base::ElapsedTimer timer;
+  auto ad_block_client =
+      std::make_unique<adblock::Engine>(custom_filters.c_str());
+  UMA_HISTOGRAM_TIMES("Brave.Shields.CustomFilters.CompileTime",
+                      timer.Elapsed());
+
+  GetTaskRunner()->PostTask(
+      FROM_HERE,
+      base::BindOnce(
+          &AdBlockCustomFiltersService::UpdateCustomFiltersOnFileTaskRunner,
+          base::Unretained(this), std::move(ad_block_client),
+          base::TimeTicks::Now()));
+}
+
+void AdBlockCustomFiltersService::UpdateCustomFiltersOnFileTaskRunner(
+    std::unique_ptr<adblock::Engine> ad_block_client,
+    base::TimeTicks compiled_at) {
   DCHECK(GetTaskRunner()->RunsTasksInCurrentSequence());
-  ad_block_client_.reset(new adblock::Engine(custom_filters.c_str()));
+  ad_block_client_.swap(ad_block_client);
+  UMA_HISTOGRAM_TIMES("Brave.Shields.CustomFilters.SwapLatency",
+                      base::TimeTicks::Now() - compiled_at);
+
+  // Tearing down a large engine is not free either, so keep it off the
+  // sequence that serves ShouldStartRequest.
+  compile_task_runner_->DeleteSoon(FROM_HERE, ad_block_client.release());
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -9,6 +9,9 @@
 #include <memory>
 #include <string>
 
+#include "base/memory/scoped_refptr.h"
+#include "base/sequenced_task_runner.h"
+#include "base/time/time.h"
 #include "brave/components/brave_shields/browser/ad_block_base_service.h"
 
 class AdBlockServiceTest;
@@ -27,12 +30,23 @@ class AdBlockCustomFiltersService : public AdBlockBaseService {
   std::string GetCustomFilters();
   bool UpdateCustomFilters(const std::string& custom_filters);
 
+  scoped_refptr<base::SequencedTaskRunner> GetCompileTaskRunnerForTesting();
+
  protected:
   bool Init() override;
 
  private:
   friend class ::AdBlockServiceTest;
-  void UpdateCustomFiltersOnFileTaskRunner(const std::string& custom_filters);
+  void CompileCustomFiltersOnCompileTaskRunner(
+      const std::string& custom_filters);
+  void UpdateCustomFiltersOnFileTaskRunner(
+      std::unique_ptr<adblock::Engine> ad_block_client,
+      base::TimeTicks compiled_at);
+
+  // Custom filters are compiled here rather than on the shields task runner so
+  // that request matching keeps using the previous engine until the new one is
+  // ready. The runner is sequenced so that the last update always wins.
+  scoped_refptr<base::SequencedTaskRunner> compile_task_runner_;
 
   DISALLOW_COPY_AND_ASSIGN(AdBlockCustomFiltersService);
 };
@@ -9,6 +9,8 @@
 #include <utility>
 #include <vector>
 
+#include "base/bind.h"
+#include "base/bind_helpers.h"
 #include "base/strings/string_util.h"
 #include "base/task/post_task.h"
 #include "base/values.h"
@@ -30,7 +32,8 @@ namespace brave_shields {
 AdBlockRegionalServiceManager::AdBlockRegionalServiceManager(
     brave_component_updater::BraveComponent::Delegate* delegate)
     : delegate_(delegate),
-      initialized_(false) {
+      initialized_(false),
+      regional_services_(std::make_shared<RegionalServiceMap>()) {
 }
 
 AdBlockRegionalServiceManager::~AdBlockRegionalServiceManager() {
@@ -69,7 +72,8 @@ void AdBlockRegionalServiceManager::StartRegionalServices() {
   }
 
   // Start all regional services associated with enabled filter lists
-  base::AutoLock lock(regional_services_lock_);
+  auto regional_services =
+      std::make_shared<RegionalServiceMap>(*GetRegionalServices());
   const base::DictionaryValue* regional_filters_dict =
       local_state->GetDictionary(kAdBlockRegionalFilters);
   for (base::DictionaryValue::Iterator it(*regional_filters_dict);
@@ -80,18 +84,21 @@ void AdBlockRegionalServiceManager::StartRegionalServices() {
     regional_filters_dict->GetDictionary(uuid, &regional_filter_dict);
     if (regional_filter_dict)
       regional_filter_dict->GetBoolean("enabled", &enabled);
-    if (enabled) {
+    // A list which already has a service keeps its loaded engine rather
+    // than loading a second copy of the same DAT file.
+    if (enabled && regional_services->find(uuid) == regional_services->end()) {
       auto catalog_entry = brave_shields::FindAdBlockFilterListByUUID(
           regional_catalog_, uuid);
       if (catalog_entry != regional_catalog_.end()) {
-        auto regional_service = AdBlockRegionalServiceFactory(
-            *catalog_entry, delegate_);
+        std::shared_ptr<AdBlockRegionalService> regional_service =
+            AdBlockRegionalServiceFactory(*catalog_entry, delegate_);
         regional_service->Start();
-        regional_services_.insert(
+        regional_services->insert(
             std::make_pair(uuid, std::move(regional_service)));
       }
     }
   }
+  SetRegionalServices(std::move(regional_services));
 
   initialized_ = true;
 }
@@ -114,9 +121,37 @@ bool AdBlockRegionalServiceManager::IsInitialized() const {
   return initialized_;
 }
 
-bool AdBlockRegionalServiceManager::Start() {
+std::shared_ptr<const AdBlockRegionalServiceManager::RegionalServiceMap>
+AdBlockRegionalServiceManager::GetRegionalServices() const {
   base::AutoLock lock(regional_services_lock_);
-  for (const auto& regional_service : regional_services_) {
+  return regional_services_;
+}
+
+void AdBlockRegionalServiceManager::SetRegionalServices(
+    std::shared_ptr<const RegionalServiceMap> services) {
+  std::shared_ptr<const RegionalServiceMap> old_services;
+  {
+    base::AutoLock lock(regional_services_lock_);
+    old_services = std::move(regional_services_);
+    regional_services_ = std::move(services);
+  }
+
+  // Services which were removed must be destroyed on the UI thread, which
+  // their weak pointers are bound to, but only after any in-flight request
+  // evaluation on the task runner is done with them. Round trip through the
+  // task runner and release the previous snapshot in the reply.
+  if (delegate_ && delegate_->GetTaskRunner()) {
+    delegate_->GetTaskRunner()->PostTaskAndReply(
+        FROM_HERE,
+        base::DoNothing(),
+        base::BindOnce([](std::shared_ptr<const RegionalServiceMap>) {},
+                       std::move(old_services)));
+  }
+}
+
+bool AdBlockRegionalServiceManager::Start() {
+  auto regional_services = GetRegionalServices();
+  for (const auto& regional_service : *regional_services) {
     regional_service.second->Start();
   }
 
@@ -130,8 +165,8 @@ bool AdBlockRegionalServiceManager::ShouldStartRequest(
     bool* matching_exception_filter,
     bool* cancel_request_explicitly,
     std::string* mock_data_url) {
-  base::AutoLock lock(regional_services_lock_);
-  for (const auto& regional_service : regional_services_) {
+  auto regional_services = GetRegionalServices();
+  for (const auto& regional_service : *regional_services) {
     if (!regional_service.second->ShouldStartRequest(
             url, resource_type, tab_host, matching_exception_filter,
             cancel_request_explicitly, mock_data_url)) {
@@ -147,16 +182,16 @@ bool AdBlockRegionalServiceManager::ShouldStartRequest(
 
 void AdBlockRegionalServiceManager::EnableTag(const std::string& tag,
                                               bool enabled) {
-  base::AutoLock lock(regional_services_lock_);
-  for (const auto& regional_service : regional_services_) {
+  auto regional_services = GetRegionalServices();
+  for (const auto& regional_service : *regional_services) {
     regional_service.second->EnableTag(tag, enabled);
   }
 }
 
 void AdBlockRegionalServiceManager::AddResources(
     const std::string& resources) {
-  base::AutoLock lock(regional_services_lock_);
-  for (const auto& regional_service : regional_services_) {
+  auto regional_services = GetRegionalServices();
+  for (const auto& regional_service : *regional_services) {
     regional_service.second->AddResources(resources);
   }
 }
@@ -169,21 +204,23 @@ void AdBlockRegionalServiceManager::EnableFilterList(
 
   // Enable or disable the specified filter list
   if (initialized_) {
-    base::AutoLock lock(regional_services_lock_);
     DCHECK(catalog_entry != regional_catalog_.end());
-    auto it = regional_services_.find(uuid);
+    auto regional_services =
+        std::make_shared<RegionalServiceMap>(*GetRegionalServices());
+    auto it = regional_services->find(uuid);
     if (enabled) {
-      DCHECK(it == regional_services_.end());
-      auto regional_service = AdBlockRegionalServiceFactory(
-          *catalog_entry, delegate_);
+      DCHECK(it == regional_services->end());
+      std::shared_ptr<AdBlockRegionalService> regional_service =
+          AdBlockRegionalServiceFactory(*catalog_entry, delegate_);
       regional_service->Start();
-      regional_services_.insert(
+      regional_services->insert(
           std::make_pair(uuid, std::move(regional_service)));
     } else {
-      DCHECK(it != regional_services_.end());
+      DCHECK(it != regional_services->end());
       it->second->Unregister();
-      regional_services_.erase(it);
+      regional_services->erase(it);
     }
+    SetRegionalServices(std::move(regional_services));
   }
 
   // Update preferences to reflect enabled/disabled state of specified
@@ -197,15 +234,15 @@ void AdBlockRegionalServiceManager::EnableFilterList(
 base::Optional<base::Value>
 AdBlockRegionalServiceManager::UrlCosmeticResources(
         const std::string& url) {
-  base::AutoLock lock(regional_services_lock_);
-  auto it = regional_services_.begin();
-  if (it == regional_services_.end()) {
+  auto regional_services = GetRegionalServices();
+  auto it = regional_services->begin();
+  if (it == regional_services->end()) {
     return base::Optional<base::Value>();
   }
   base::Optional<base::Value> first_value =
       it->second->UrlCosmeticResources(url);
 
-  for ( ; it != regional_services_.end(); it++) {
+  for (++it; it != regional_services->end(); it++) {
     base::Optional<base::Value> next_value =
         it->second->UrlCosmeticResources(url);
     if (first_value) {
@@ -225,15 +262,15 @@ AdBlockRegionalServiceManager::HiddenClassIdSelectors(
         const std::vector<std::string>& classes,
         const std::vector<std::string>& ids,
         const std::vector<std::string>& exceptions) {
-  base::AutoLock lock(regional_services_lock_);
-  auto it = regional_services_.begin();
-  if (it == regional_services_.end()) {
+  auto regional_services = GetRegionalServices();
+  auto it = regional_services->begin();
+  if (it == regional_services->end()) {
     return base::Optional<base::Value>();
   }
   base::Optional<base::Value> first_value =
       it->second->HiddenClassIdSelectors(classes, ids, exceptions);
 
-  for ( ; it != regional_services_.end(); it++) {
+  for (++it; it != regional_services->end(); it++) {
     base::Optional<base::Value> next_value =
         it->second->HiddenClassIdSelectors(classes, ids, exceptions);
     if (first_value && first_value->is_list()) {
@@ -255,7 +292,8 @@ AdBlockRegionalServiceManager::HiddenClassIdSelectors(
 void AdBlockRegionalServiceManager::SetRegionalCatalog(
         std::vector<adblock::FilterList> catalog) {
   regional_catalog_ = std::move(catalog);
-  for (const auto& regional_service : regional_services_) {
+  auto regional_services = GetRegionalServices();
+  for (const auto& regional_service : *regional_services) {
     auto catalog_entry = brave_shields::FindAdBlockFilterListByUUID(
         regional_catalog_, regional_service.second->GetUUID());
     if (catalog_entry != regional_catalog_.end()) {
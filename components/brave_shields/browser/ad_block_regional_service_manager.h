@@ -66,15 +66,25 @@ class AdBlockRegionalServiceManager {
 
  private:
   friend class ::AdBlockServiceTest;
+
+  using RegionalServiceMap =
+      std::map<std::string, std::shared_ptr<AdBlockRegionalService>>;
+
   bool Init();
   void StartRegionalServices();
   void UpdateFilterListPrefs(const std::string& uuid, bool enabled);
 
+  // Returns an immutable snapshot of the currently enabled regional services.
+  // Request evaluation iterates a snapshot without holding any lock, so it
+  // never waits on filter lists being enabled or disabled.
+  std::shared_ptr<const RegionalServiceMap> GetRegionalServices() const;
+  void SetRegionalServices(std::shared_ptr<const RegionalServiceMap> services);
+
   brave_component_updater::BraveComponent::Delegate* delegate_;  // NOT OWNED
   bool initialized_;
-  base::Lock regional_services_lock_;
-  std::map<std::string, std::unique_ptr<AdBlockRegionalService>>
-      regional_services_;
+  // Only guards swapping |regional_services_|, which is copied on write
+  mutable base::Lock regional_services_lock_;
+  std::shared_ptr<const RegionalServiceMap> regional_services_;
 
   std::vector<adblock::FilterList> regional_catalog_;
 
@@ -388,6 +388,18 @@ bool GetHTTPSEverywhereEnabled(HostContentSettingsMap* map, const GURL& url) {
   return setting == CONTENT_SETTING_ALLOW ? false : true;
 }
 
+ShieldsSettings GetShieldsSettings(HostContentSettingsMap* map,
+                                   const GURL& tab_origin) {
+  ShieldsSettings settings;
+  settings.brave_shields_enabled = GetBraveShieldsEnabled(map, tab_origin);
+  settings.allow_ads =
+      GetAdControlType(map, tab_origin) == ControlType::ALLOW;
+  settings.https_everywhere_enabled =
+      GetHTTPSEverywhereEnabled(map, tab_origin);
+  settings.allow_referrers = AllowReferrers(map, tab_origin);
+  return settings;
+}
+
 void SetNoScriptControlType(HostContentSettingsMap* map,
                             ControlType type,
                             const GURL& url,
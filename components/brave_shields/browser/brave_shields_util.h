@@ -87,6 +87,18 @@ void SetNoScriptControlType(HostContentSettingsMap* map,
 ControlType GetNoScriptControlType(HostContentSettingsMap* map,
                                    const GURL& url);
 
+// Shields settings used by the network delegate helpers, resolved for the
+// origin of the tab in which requests are made.
+struct ShieldsSettings {
+  bool brave_shields_enabled = true;
+  bool allow_ads = false;
+  bool https_everywhere_enabled = true;
+  bool allow_referrers = false;
+};
+
+ShieldsSettings GetShieldsSettings(HostContentSettingsMap* map,
+                                   const GURL& tab_origin);
+
 void DispatchBlockedEvent(const GURL& request_url,
                           int render_frame_id,
                           int render_process_id,
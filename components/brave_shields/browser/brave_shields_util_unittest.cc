@@ -926,3 +926,34 @@ TEST_F(BraveShieldsUtilTest, GetNoScriptControlType_ForOrigin) {
   setting = brave_shields::GetNoScriptControlType(map, GURL());
   EXPECT_EQ(ControlType::BLOCK, setting);
 }
+
+/* SHIELDS SETTINGS */
+TEST_F(BraveShieldsUtilTest, GetShieldsSettings) {
+  auto* map = HostContentSettingsMapFactory::GetForProfile(profile());
+
+  auto settings = brave_shields::GetShieldsSettings(map,
+                                                    GURL("https://brave.com"));
+  EXPECT_TRUE(settings.brave_shields_enabled);
+  EXPECT_FALSE(settings.allow_ads);
+  EXPECT_TRUE(settings.https_everywhere_enabled);
+  EXPECT_FALSE(settings.allow_referrers);
+
+  map->SetContentSettingCustomScope(
+      ContentSettingsPattern::FromString("https://brave.com/*"),
+      ContentSettingsPattern::Wildcard(), ContentSettingsType::PLUGINS,
+      brave_shields::kAds, CONTENT_SETTING_ALLOW);
+  map->SetContentSettingCustomScope(
+      ContentSettingsPattern::FromString("https://brave.com/*"),
+      ContentSettingsPattern::Wildcard(), ContentSettingsType::PLUGINS,
+      brave_shields::kHTTPUpgradableResources, CONTENT_SETTING_ALLOW);
+
+  settings = brave_shields::GetShieldsSettings(map, GURL("https://brave.com"));
+  EXPECT_TRUE(settings.brave_shields_enabled);
+  EXPECT_TRUE(settings.allow_ads);
+  EXPECT_FALSE(settings.https_everywhere_enabled);
+
+  // other origins are unchanged
+  settings = brave_shields::GetShieldsSettings(map, GURL("https://brave2.com"));
+  EXPECT_FALSE(settings.allow_ads);
+  EXPECT_TRUE(settings.https_everywhere_enabled);
+}
@@ -5,6 +5,7 @@
 
 #include "brave/components/brave_shields/browser/brave_shields_web_contents_observer.h"
 
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
@@ -12,6 +13,7 @@
 #include <vector>
 
 #include "base/strings/utf_string_conversions.h"
+#include "base/time/time.h"
 #include "brave/common/pref_names.h"
 #include "brave/common/render_messages.h"
 #include "brave/components/brave_shields/browser/brave_shields_util.h"
@@ -80,6 +82,31 @@ void UpdateContentSettingsToRendererFrames(content::WebContents* web_contents) {
   }
 }
 
+// Blocked events are dispatched to the extension at most once a frame
+const int64_t kBlockedEventsDelayInMilliseconds = 16;
+
+const int64_t kBlockedStatsDelayInSeconds = 1;
+
+bool g_dispatch_immediately_for_testing = false;
+
+// Requests are made for the current page's origin, and briefly for the
+// previous or next one while the main frame navigates
+const size_t kMaxShieldsSettings = 4;
+
+const char* GetBlockedStatsPrefName(const std::string& block_type) {
+  if (block_type == brave_shields::kAds) {
+    return kAdsBlocked;
+  } else if (block_type == brave_shields::kHTTPUpgradableResources) {
+    return kHttpsUpgrades;
+  } else if (block_type == brave_shields::kJavaScript) {
+    return kJavascriptBlocked;
+  } else if (block_type == brave_shields::kFingerprintingV2) {
+    return kFingerprintingBlocked;
+  }
+
+  return nullptr;
+}
+
 WebContents* GetWebContents(
     int render_process_id,
     int render_frame_id,
@@ -131,11 +158,15 @@ bool BraveShieldsWebContentsObserver::RenderFrameIdKey::operator==(
 }
 
 BraveShieldsWebContentsObserver::~BraveShieldsWebContentsObserver() {
+  host_content_settings_map_->RemoveObserver(this);
 }
 
 BraveShieldsWebContentsObserver::BraveShieldsWebContentsObserver(
     WebContents* web_contents)
-    : WebContentsObserver(web_contents) {
+    : WebContentsObserver(web_contents),
+      host_content_settings_map_(HostContentSettingsMapFactory::GetForProfile(
+          Profile::FromBrowserContext(web_contents->GetBrowserContext()))) {
+  host_content_settings_map_->AddObserver(this);
 }
 
 void BraveShieldsWebContentsObserver::RenderFrameCreated(
@@ -177,6 +208,12 @@ void BraveShieldsWebContentsObserver::RenderFrameHostChanged(
 
 void BraveShieldsWebContentsObserver::DidFinishNavigation(
     content::NavigationHandle* navigation_handle) {
+  if (navigation_handle->IsInMainFrame() &&
+      navigation_handle->HasCommitted() &&
+      !navigation_handle->IsSameDocument()) {
+    shields_settings_.clear();
+  }
+
   RenderFrameHost* main_frame = web_contents()->GetMainFrame();
   if (!web_contents() || !main_frame) {
     return;
@@ -190,6 +227,13 @@ void BraveShieldsWebContentsObserver::DidFinishNavigation(
   frame_tree_node_id_to_tab_url_[tree_node_id] = web_contents()->GetURL();
 }
 
+void BraveShieldsWebContentsObserver::WebContentsDestroyed() {
+  pending_blocked_resources_.clear();
+  blocked_events_timer_.Stop();
+
+  FlushBlockedStats();
+}
+
 // static
 GURL BraveShieldsWebContentsObserver::GetTabURLFromRenderFrameInfo(
     int render_process_id, int render_frame_id, int render_frame_tree_node_id) {
@@ -210,14 +254,62 @@ GURL BraveShieldsWebContentsObserver::GetTabURLFromRenderFrameInfo(
   return GURL();
 }
 
+// static
+ShieldsSettings BraveShieldsWebContentsObserver::GetShieldsSettingsForFrame(
+    HostContentSettingsMap* map,
+    const GURL& tab_origin,
+    int render_process_id,
+    int render_frame_id,
+    int frame_tree_node_id) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+
+  WebContents* web_contents = GetWebContents(render_process_id,
+    render_frame_id, frame_tree_node_id);
+  BraveShieldsWebContentsObserver* observer = web_contents ?
+      BraveShieldsWebContentsObserver::FromWebContents(web_contents) : nullptr;
+  if (!observer || observer->host_content_settings_map_ != map) {
+    return brave_shields::GetShieldsSettings(map, tab_origin);
+  }
+
+  return observer->GetShieldsSettings(tab_origin);
+}
+
+const ShieldsSettings& BraveShieldsWebContentsObserver::GetShieldsSettings(
+    const GURL& tab_origin) {
+  auto iter = shields_settings_.find(tab_origin);
+  if (iter != shields_settings_.end()) {
+    return iter->second;
+  }
+
+  if (shields_settings_.size() >= kMaxShieldsSettings) {
+    shields_settings_.clear();
+  }
+
+  return shields_settings_.emplace(tab_origin,
+      brave_shields::GetShieldsSettings(host_content_settings_map_,
+                                        tab_origin)).first->second;
+}
+
+void BraveShieldsWebContentsObserver::OnContentSettingChanged(
+    const ContentSettingsPattern& primary_pattern,
+    const ContentSettingsPattern& secondary_pattern,
+    ContentSettingsType content_type,
+    const std::string& resource_identifier) {
+  // All shields settings are stored as plugins resources
+  if (content_type == ContentSettingsType::PLUGINS) {
+    shields_settings_.clear();
+  }
+}
+
 bool BraveShieldsWebContentsObserver::IsBlockedSubresource(
     const std::string& subresource) {
-  return blocked_url_paths_.find(subresource) != blocked_url_paths_.end();
+  return blocked_url_paths_.find(std::hash<std::string>()(subresource)) !=
+      blocked_url_paths_.end();
 }
 
 void BraveShieldsWebContentsObserver::AddBlockedSubresource(
     const std::string& subresource) {
-  blocked_url_paths_.insert(subresource);
+  blocked_url_paths_.insert(std::hash<std::string>()(subresource));
 }
 
 // static
@@ -231,32 +323,85 @@ void BraveShieldsWebContentsObserver::DispatchBlockedEvent(
 
   WebContents* web_contents = GetWebContents(render_process_id,
     render_frame_id, frame_tree_node_id);
-  DispatchBlockedEventForWebContents(block_type, subresource, web_contents);
+  if (!web_contents) {
+    return;
+  }
 
-  if (web_contents) {
-    BraveShieldsWebContentsObserver* observer =
-        BraveShieldsWebContentsObserver::FromWebContents(web_contents);
-    if (observer &&
-        !observer->IsBlockedSubresource(subresource)) {
-      observer->AddBlockedSubresource(subresource);
-      PrefService* prefs = Profile::FromBrowserContext(
-          web_contents->GetBrowserContext())->
-          GetOriginalProfile()->
-          GetPrefs();
-
-      if (block_type == kAds) {
-        prefs->SetUint64(kAdsBlocked, prefs->GetUint64(kAdsBlocked) + 1);
-      } else if (block_type == kHTTPUpgradableResources) {
-        prefs->SetUint64(kHttpsUpgrades, prefs->GetUint64(kHttpsUpgrades) + 1);
-      } else if (block_type == kJavaScript) {
-        prefs->SetUint64(kJavascriptBlocked,
-            prefs->GetUint64(kJavascriptBlocked) + 1);
-      } else if (block_type == kFingerprintingV2) {
-        prefs->SetUint64(kFingerprintingBlocked,
-            prefs->GetUint64(kFingerprintingBlocked) + 1);
-      }
-    }
+  BraveShieldsWebContentsObserver* observer =
+      BraveShieldsWebContentsObserver::FromWebContents(web_contents);
+  if (!observer) {
+    DispatchBlockedEventForWebContents(block_type, subresource, web_contents);
+    return;
+  }
+
+  observer->OnBlocked(block_type, subresource);
+}
+
+// static
+void BraveShieldsWebContentsObserver::SetDispatchImmediatelyForTesting(
+    bool dispatch_immediately) {
+  g_dispatch_immediately_for_testing = dispatch_immediately;
+}
+
+void BraveShieldsWebContentsObserver::OnBlocked(
+    const std::string& block_type,
+    const std::string& subresource) {
+  pending_blocked_resources_.emplace_back(block_type, subresource);
+  if (g_dispatch_immediately_for_testing) {
+    FlushBlockedEvents();
+  } else if (!blocked_events_timer_.IsRunning()) {
+    blocked_events_timer_.Start(FROM_HERE,
+        base::TimeDelta::FromMilliseconds(kBlockedEventsDelayInMilliseconds),
+        this, &BraveShieldsWebContentsObserver::FlushBlockedEvents);
+  }
+
+  if (IsBlockedSubresource(subresource)) {
+    return;
+  }
+  AddBlockedSubresource(subresource);
+
+  const char* pref_name = GetBlockedStatsPrefName(block_type);
+  if (!pref_name) {
+    return;
+  }
+
+  pending_blocked_stats_[pref_name]++;
+  if (g_dispatch_immediately_for_testing) {
+    FlushBlockedStats();
+  } else if (!blocked_stats_timer_.IsRunning()) {
+    blocked_stats_timer_.Start(FROM_HERE,
+        base::TimeDelta::FromSeconds(kBlockedStatsDelayInSeconds),
+        this, &BraveShieldsWebContentsObserver::FlushBlockedStats);
+  }
+}
+
+void BraveShieldsWebContentsObserver::FlushBlockedEvents() {
+  blocked_events_timer_.Stop();
+  if (pending_blocked_resources_.empty()) {
+    return;
+  }
+
+  BlockedResources blocked_resources;
+  blocked_resources.swap(pending_blocked_resources_);
+  DispatchBlockedEventsForWebContents(blocked_resources, web_contents());
+}
+
+void BraveShieldsWebContentsObserver::FlushBlockedStats() {
+  blocked_stats_timer_.Stop();
+  if (pending_blocked_stats_.empty() || !web_contents()) {
+    return;
+  }
+
+  PrefService* prefs = Profile::FromBrowserContext(
+      web_contents()->GetBrowserContext())->
+      GetOriginalProfile()->
+      GetPrefs();
+
+  for (const auto& blocked_stat : pending_blocked_stats_) {
+    prefs->SetUint64(blocked_stat.first,
+        prefs->GetUint64(blocked_stat.first) + blocked_stat.second);
   }
+  pending_blocked_stats_.clear();
 }
 
 #if !defined(OS_ANDROID)
@@ -287,6 +432,38 @@ void BraveShieldsWebContentsObserver::DispatchBlockedEventForWebContents(
   }
 #endif
 }
+
+// static
+void BraveShieldsWebContentsObserver::DispatchBlockedEventsForWebContents(
+    const BlockedResources& blocked_resources,
+    WebContents* web_contents) {
+#if BUILDFLAG(ENABLE_EXTENSIONS)
+  if (!web_contents) {
+    return;
+  }
+  Profile* profile =
+      Profile::FromBrowserContext(web_contents->GetBrowserContext());
+  EventRouter* event_router = EventRouter::Get(profile);
+  if (profile && event_router) {
+    extensions::api::brave_shields::OnBlockedResources::Details details;
+    details.tab_id = extensions::ExtensionTabUtil::GetTabId(web_contents);
+    for (const auto& blocked_resource : blocked_resources) {
+      extensions::api::brave_shields::BlockedResource resource;
+      resource.block_type = blocked_resource.first;
+      resource.subresource = blocked_resource.second;
+      details.resources.push_back(std::move(resource));
+    }
+    std::unique_ptr<base::ListValue> args(
+        extensions::api::brave_shields::OnBlockedResources::Create(details)
+          .release());
+    std::unique_ptr<Event> event(
+        new Event(extensions::events::BRAVE_AD_BLOCKED,
+          extensions::api::brave_shields::OnBlockedResources::kEventName,
+          std::move(args)));
+    event_router->BroadcastEvent(std::move(event));
+  }
+#endif
+}
 #endif
 
 bool BraveShieldsWebContentsObserver::OnMessageReceived(
@@ -339,6 +516,13 @@ void BraveShieldsWebContentsObserver::RegisterProfilePrefs(
 
 void BraveShieldsWebContentsObserver::ReadyToCommitNavigation(
     content::NavigationHandle* navigation_handle) {
+  // Resources blocked by the previous page must not be attributed to the new
+  // one
+  if (navigation_handle->IsInMainFrame() &&
+      !navigation_handle->IsSameDocument()) {
+    FlushBlockedEvents();
+  }
+
   // when the main frame navigate away
   if (navigation_handle->IsInMainFrame() &&
       !navigation_handle->IsSameDocument() &&
@@ -6,14 +6,21 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_BRAVE_SHIELDS_WEB_CONTENTS_OBSERVER_H_
 #define BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_BRAVE_SHIELDS_WEB_CONTENTS_OBSERVER_H_
 
+#include <stddef.h>
+#include <stdint.h>
+
 #include <map>
-#include <set>
 #include <string>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "base/macros.h"
 #include "base/synchronization/lock.h"
 #include "base/strings/string16.h"
+#include "base/timer/timer.h"
+#include "brave/components/brave_shields/browser/brave_shields_util.h"
+#include "components/content_settings/core/browser/content_settings_observer.h"
 #include "content/public/browser/web_contents_observer.h"
 #include "content/public/browser/web_contents_user_data.h"
 
@@ -21,11 +28,13 @@ namespace content {
 class WebContents;
 }
 
+class HostContentSettingsMap;
 class PrefRegistrySimple;
 
 namespace brave_shields {
 
 class BraveShieldsWebContentsObserver : public content::WebContentsObserver,
+    public content_settings::Observer,
     public content::WebContentsUserData<BraveShieldsWebContentsObserver> {
  public:
   explicit BraveShieldsWebContentsObserver(content::WebContents*);
@@ -36,6 +45,11 @@ class BraveShieldsWebContentsObserver : public content::WebContentsObserver,
       const std::string& block_type,
       const std::string& subresource,
       content::WebContents* web_contents);
+  // Blocked resources as pairs of block type and subresource
+  using BlockedResources = std::vector<std::pair<std::string, std::string>>;
+  static void DispatchBlockedEventsForWebContents(
+      const BlockedResources& blocked_resources,
+      content::WebContents* web_contents);
   static void DispatchBlockedEvent(
       std::string block_type,
       std::string subresource,
@@ -44,6 +58,18 @@ class BraveShieldsWebContentsObserver : public content::WebContentsObserver,
   static GURL GetTabURLFromRenderFrameInfo(int render_process_id,
                                            int render_frame_id,
                                            int render_frame_tree_node_id);
+  // Returns the shields settings for requests made by the frame. They are
+  // resolved once per tab origin and page by the tab's observer, or from
+  // |map| for requests which do not belong to a tab.
+  static ShieldsSettings GetShieldsSettingsForFrame(
+      HostContentSettingsMap* map,
+      const GURL& tab_origin,
+      int render_process_id,
+      int render_frame_id,
+      int frame_tree_node_id);
+  // Dispatches blocked events and updates the stats prefs as soon as a
+  // resource is blocked rather than in batches
+  static void SetDispatchImmediatelyForTesting(bool dispatch_immediately);
   void AllowScriptsOnce(const std::vector<std::string>& origins,
                         content::WebContents* web_contents);
   bool IsBlockedSubresource(const std::string& subresource);
@@ -74,6 +100,7 @@ class BraveShieldsWebContentsObserver : public content::WebContentsObserver,
       content::NavigationHandle* navigation_handle) override;
   void DidFinishNavigation(
       content::NavigationHandle* navigation_handle) override;
+  void WebContentsDestroyed() override;
 
   // Invoked if an IPC message is coming from a specific RenderFrameHost.
   bool OnMessageReceived(const IPC::Message& message,
@@ -85,6 +112,12 @@ class BraveShieldsWebContentsObserver : public content::WebContentsObserver,
       content::RenderFrameHost* render_frame_host,
       const base::string16& details);
 
+  // content_settings::Observer overrides.
+  void OnContentSettingChanged(const ContentSettingsPattern& primary_pattern,
+                               const ContentSettingsPattern& secondary_pattern,
+                               ContentSettingsType content_type,
+                               const std::string& resource_identifier) override;
+
   // TODO(iefremov): Refactor this away or at least put into base::NoDestructor.
   // Protects global maps below from being concurrently written on the UI thread
   // and read on the IO thread.
@@ -94,10 +127,32 @@ class BraveShieldsWebContentsObserver : public content::WebContentsObserver,
 
  private:
   friend class content::WebContentsUserData<BraveShieldsWebContentsObserver>;
+
+  void OnBlocked(const std::string& block_type,
+                 const std::string& subresource);
+  void FlushBlockedEvents();
+  void FlushBlockedStats();
+
+  const ShieldsSettings& GetShieldsSettings(const GURL& tab_origin);
+
+  HostContentSettingsMap* host_content_settings_map_;  // NOT OWNED
+
+  // Shields settings resolved for the origins of the current page, cleared
+  // when the main frame navigates or a shields setting changes.
+  std::map<GURL, ShieldsSettings> shields_settings_;
+
   std::vector<std::string> allowed_script_origins_;
-  // We keep a set of the current page's blocked URLs in case the page
-  // continually tries to load the same blocked URLs.
-  std::set<std::string> blocked_url_paths_;
+  // We keep a set of hashes of the current page's blocked URLs in case the
+  // page continually tries to load the same blocked URLs.
+  std::unordered_set<size_t> blocked_url_paths_;
+
+  // Ad heavy pages block hundreds of resources a second, so blocked events
+  // are dispatched to the extension in batches and the stats prefs are only
+  // written periodically.
+  BlockedResources pending_blocked_resources_;
+  base::OneShotTimer blocked_events_timer_;
+  std::map<std::string, uint64_t> pending_blocked_stats_;
+  base::OneShotTimer blocked_stats_timer_;
 
   WEB_CONTENTS_USER_DATA_KEY_DECL();
   DISALLOW_COPY_AND_ASSIGN(BraveShieldsWebContentsObserver);
@@ -33,4 +33,14 @@ void BraveShieldsWebContentsObserver::DispatchBlockedEventForWebContents(
       tabId, block_type, subresource);
 }
 
+// static
+void BraveShieldsWebContentsObserver::DispatchBlockedEventsForWebContents(
+    const BlockedResources& blocked_resources,
+    WebContents* web_contents) {
+  for (const auto& blocked_resource : blocked_resources) {
+    DispatchBlockedEventForWebContents(blocked_resource.first,
+        blocked_resource.second, web_contents);
+  }
+}
+
 }  // namespace brave_shields
@@ -0,0 +1,68 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_HTTPS_EVERYWHERE_RULE_SET_H_
+#define BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_HTTPS_EVERYWHERE_RULE_SET_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/macros.h"
+
+namespace re2 {
+class RE2;
+}  // namespace re2
+
+namespace brave_shields {
+
+// A compiled form of the JSON rules stored for a single HTTPS Everywhere
+// database key. Regular expressions are compiled once when the rule set is
+// parsed so that applying the rules to a URL does not re-parse or recompile
+// anything.
+class HTTPSERuleSet {
+ public:
+  ~HTTPSERuleSet();
+
+  // Returns nullptr if |json| is not a list of rules
+  static std::unique_ptr<HTTPSERuleSet> Parse(const std::string& json);
+
+  // Returns the rewritten URL, or an empty string if no rule applies
+  std::string Apply(const std::string& original_url) const;
+
+  // Converts $N backreferences in a rule into the \N form used by RE2
+  static std::string CorrectToRuleToRE2Engine(const std::string& to);
+
+ private:
+  struct Rule {
+    Rule();
+    Rule(Rule&& other);
+    ~Rule();
+
+    bool is_default = false;
+    std::unique_ptr<re2::RE2> from;
+    std::string to;
+  };
+
+  struct Target {
+    Target();
+    Target(Target&& other);
+    ~Target();
+
+    std::vector<std::unique_ptr<re2::RE2>> exclusions;
+    bool has_rules = false;
+    std::vector<Rule> rules;
+  };
+
+  HTTPSERuleSet();
+
+  std::vector<Target> targets_;
+
+  DISALLOW_COPY_AND_ASSIGN(HTTPSERuleSet);
+};
+
+}  // namespace brave_shields
+
+#endif  // BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_HTTPS_EVERYWHERE_RULE_SET_H_
@@ -0,0 +1,74 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <memory>
+#include <string>
+
+#include "brave/components/brave_shields/browser/https_everywhere_rule_set.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+using brave_shields::HTTPSERuleSet;
+
+TEST(HTTPSEverywhereRuleSetTest, InvalidJson) {
+  EXPECT_FALSE(HTTPSERuleSet::Parse(""));
+  EXPECT_FALSE(HTTPSERuleSet::Parse("{}"));
+  EXPECT_FALSE(HTTPSERuleSet::Parse("[{"));
+}
+
+TEST(HTTPSEverywhereRuleSetTest, DefaultRule) {
+  std::unique_ptr<HTTPSERuleSet> rule_set =
+      HTTPSERuleSet::Parse(R"([{"r":[{"d":1}]}])");
+  ASSERT_TRUE(rule_set);
+  EXPECT_EQ(rule_set->Apply("http://www.example.com/path"),
+            "https://www.example.com/path");
+}
+
+TEST(HTTPSEverywhereRuleSetTest, FromToRule) {
+  std::unique_ptr<HTTPSERuleSet> rule_set = HTTPSERuleSet::Parse(
+      R"([{"r":[{"f":"^http://(www\\.)?example\\.com/",)"
+      R"("t":"https://$1example.com/"}]}])");
+  ASSERT_TRUE(rule_set);
+  EXPECT_EQ(rule_set->Apply("http://www.example.com/path"),
+            "https://www.example.com/path");
+  EXPECT_EQ(rule_set->Apply("http://example.com/path"),
+            "https://example.com/path");
+  EXPECT_EQ(rule_set->Apply("http://other.example.com/path"), "");
+
+  // Applying the same compiled rule set again gives the same result
+  EXPECT_EQ(rule_set->Apply("http://example.com/path"),
+            "https://example.com/path");
+}
+
+TEST(HTTPSEverywhereRuleSetTest, Exclusion) {
+  std::unique_ptr<HTTPSERuleSet> rule_set = HTTPSERuleSet::Parse(
+      R"([{"e":[{"p":"^http://example\\.com/insecure/.*"}],)"
+      R"("r":[{"d":1}]}])");
+  ASSERT_TRUE(rule_set);
+  EXPECT_EQ(rule_set->Apply("http://example.com/insecure/page"), "");
+  EXPECT_EQ(rule_set->Apply("http://example.com/secure/page"),
+            "https://example.com/secure/page");
+}
+
+TEST(HTTPSEverywhereRuleSetTest, MissingRules) {
+  // A target without rules stops evaluation of the following targets
+  std::unique_ptr<HTTPSERuleSet> rule_set =
+      HTTPSERuleSet::Parse(R"([{}, {"r":[{"d":1}]}])");
+  ASSERT_TRUE(rule_set);
+  EXPECT_EQ(rule_set->Apply("http://example.com/"), "");
+}
+
+TEST(HTTPSEverywhereRuleSetTest, InvalidPatternIsSkipped) {
+  std::unique_ptr<HTTPSERuleSet> rule_set = HTTPSERuleSet::Parse(
+      R"([{"r":[{"f":"(","t":"https://"},{"d":1}]}])");
+  ASSERT_TRUE(rule_set);
+  EXPECT_EQ(rule_set->Apply("http://example.com/"), "https://example.com/");
+}
+
+TEST(HTTPSEverywhereRuleSetTest, CorrectToRuleToRE2Engine) {
+  EXPECT_EQ(HTTPSERuleSet::CorrectToRuleToRE2Engine("https://$1$2/"),
+            "https://\\1\\2/");
+  EXPECT_EQ(HTTPSERuleSet::CorrectToRuleToRE2Engine("https://a/"),
+            "https://a/");
+}
@@ -10,12 +10,14 @@
 #include <string>
 #include <vector>
 
+#include "base/containers/mru_cache.h"
 #include "base/files/file_path.h"
 #include "base/memory/weak_ptr.h"
 #include "base/sequence_checker.h"
 #include "base/synchronization/lock.h"
 #include "brave/components/brave_shields/browser/base_brave_shields_service.h"
 #include "brave/components/brave_shields/browser/https_everywhere_recently_used_cache.h"
+#include "brave/components/brave_shields/browser/https_everywhere_rule_set.h"
 
 namespace leveldb {
 class DB;
@@ -63,9 +65,6 @@ class HTTPSEverywhereService : public BaseBraveShieldsService,
 
   void AddHTTPSEUrlToRedirectList(const uint64_t& request_id);
   bool ShouldHTTPSERedirect(const uint64_t& request_id);
-  std::string ApplyHTTPSRule(const std::string& originalUrl,
-      const std::string& rule);
-  std::string CorrecttoRuleToRE2Engine(const std::string& to);
 
  private:
   friend class ::HTTPSEverywhereServiceTest;
@@ -81,9 +80,20 @@ class HTTPSEverywhereService : public BaseBraveShieldsService,
 
   void InitDB(const base::FilePath& install_dir);
 
+  bool LookupHTTPSURL(const GURL& candidate_url, std::string* new_url);
+
+  // Returns the compiled rule set stored for |key|, or nullptr if the
+  // database has no rules for it
+  const HTTPSERuleSet* GetRuleSet(const std::string& key);
+
   base::Lock httpse_get_urls_redirects_count_mutex_;
   std::vector<HTTPSE_REDIRECTS_COUNT_ST> httpse_urls_redirects_count_;
   HTTPSERecentlyUsedCache<std::string> recently_used_cache_;
+  // Compiled rule sets keyed by database key. A null entry records that the
+  // database has no rules for the key.
+  base::MRUCache<std::string, std::unique_ptr<HTTPSERuleSet>> rule_set_cache_;
+  // Hosts for which none of the expanded database keys have rules
+  base::MRUCache<std::string, bool> no_rules_host_cache_;
   leveldb::DB* level_db_;
 
   SEQUENCE_CHECKER(sequence_checker_);
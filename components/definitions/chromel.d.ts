@@ -235,6 +235,14 @@ interface BlockDetails {
   tabId: number
   subresource: string
 }
+
+interface BlockedResourcesDetails {
+  tabId: number
+  resources: Array<{
+    blockType: BlockTypes
+    subresource: string
+  }>
+}
 declare namespace chrome.tabs {
   const setAsync: any
   const getAsync: any
@@ -249,6 +257,10 @@ declare namespace chrome.braveShields {
     addListener: (callback: (detail: BlockDetails) => void) => void
     emit: (detail: BlockDetails) => void
   }
+  const onBlockedResources: {
+    addListener: (callback: (details: BlockedResourcesDetails) => void) => void
+    emit: (details: BlockedResourcesDetails) => void
+  }
 
   const allowScriptsOnce: any
   const setBraveShieldsEnabledAsync: any
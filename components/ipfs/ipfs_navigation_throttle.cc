@@ -106,6 +106,11 @@ IpfsNavigationThrottle::WillStartRequest() {
 
   // Check # of connected peers before using local node.
   if (is_local_mode && ipfs_service_->IsDaemonLaunched()) {
+    // The service refreshes its peers in the background, so there is no need
+    // to wait on the daemon while the last refresh still has connected peers.
+    if (ipfs_service_->HasFreshConnectedPeers())
+      return content::NavigationThrottle::PROCEED;
+
     resume_pending_ = true;
     ipfs_service_->GetConnectedPeers(
         base::BindOnce(&IpfsNavigationThrottle::OnGetConnectedPeers,
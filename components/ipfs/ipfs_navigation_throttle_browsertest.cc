@@ -218,4 +218,31 @@ IN_PROC_BROWSER_TEST_F(IpfsNavigationThrottleBrowserTest,
   EXPECT_EQ(nullptr, GetInterstitialType(web_contents));
 }
 
+IN_PROC_BROWSER_TEST_F(IpfsNavigationThrottleBrowserTest,
+                       UseCachedConnectedPeersWhenFresh) {
+  ResetTestServer(base::BindRepeating(
+      &IpfsNavigationThrottleBrowserTest::HandleGetConnectedPeers,
+      base::Unretained(this)));
+
+  GetPrefs()->SetInteger(kIPFSResolveMethod,
+                         static_cast<int>(IPFSResolveMethodTypes::IPFS_LOCAL));
+
+  ui_test_utils::NavigateToURL(browser(), ipfs_url());
+  content::WebContents* web_contents =
+      browser()->tab_strip_model()->GetActiveWebContents();
+  EXPECT_TRUE(WaitForRenderFrameReady(web_contents->GetMainFrame()));
+  EXPECT_EQ(nullptr, GetInterstitialType(web_contents));
+  EXPECT_TRUE(ipfs_service()->HasFreshConnectedPeers());
+
+  // The daemon now reports no peers, but the navigation is resumed from the
+  // cached connectivity state without asking it again.
+  ResetTestServer(base::BindRepeating(
+      &IpfsNavigationThrottleBrowserTest::HandleGetEmptyConnectedPeers,
+      base::Unretained(this)));
+  ui_test_utils::NavigateToURL(browser(), ipfs_url());
+  web_contents = browser()->tab_strip_model()->GetActiveWebContents();
+  EXPECT_TRUE(WaitForRenderFrameReady(web_contents->GetMainFrame()));
+  EXPECT_EQ(nullptr, GetInterstitialType(web_contents));
+}
+
 }  // namespace ipfs
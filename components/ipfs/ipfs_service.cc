@@ -7,6 +7,7 @@
 
 #include <utility>
 
+#include "base/callback_helpers.h"
 #include "base/command_line.h"
 #include "base/feature_list.h"
 #include "base/files/file_util.h"
@@ -61,6 +62,13 @@ net::NetworkTrafficAnnotationTag GetNetworkTrafficAnnotationTag() {
     )");
 }
 
+// How often the connected peers are refreshed while the daemon is running, and
+// how long a refresh is trusted before callers need to ask the daemon again.
+constexpr base::TimeDelta kConnectedPeersRefreshInterval =
+    base::TimeDelta::FromSeconds(30);
+constexpr base::TimeDelta kConnectedPeersMaxAge =
+    base::TimeDelta::FromSeconds(60);
+
 std::pair<bool, std::string> LoadConfigFileOnFileTaskRunner(
     const base::FilePath& path) {
   std::string data;
@@ -185,6 +193,11 @@ base::FilePath IpfsService::GetConfigFilePath() const {
 void IpfsService::OnIpfsLaunched(bool result, int64_t pid) {
   if (result) {
     ipfs_pid_ = pid;
+    RefreshConnectedPeers();
+    connected_peers_timer_.Start(
+        FROM_HERE, kConnectedPeersRefreshInterval,
+        base::BindRepeating(&IpfsService::RefreshConnectedPeers,
+                            base::Unretained(this)));
   } else {
     VLOG(0) << "Failed to launch IPFS";
     Shutdown();
@@ -206,6 +219,26 @@ void IpfsService::Shutdown() {
 
   ipfs_service_.reset();
   ipfs_pid_ = -1;
+  ResetConnectedPeers();
+}
+
+void IpfsService::RefreshConnectedPeers() {
+  GetConnectedPeers(
+      base::DoNothing::Once<bool, const std::vector<std::string>&>());
+}
+
+void IpfsService::ResetConnectedPeers() {
+  connected_peers_timer_.Stop();
+  connected_peers_count_ = 0;
+  connected_peers_refreshed_at_ = base::TimeTicks();
+}
+
+bool IpfsService::HasFreshConnectedPeers() const {
+  if (!IsDaemonLaunched() || connected_peers_count_ == 0)
+    return false;
+
+  return base::TimeTicks::Now() - connected_peers_refreshed_at_ <=
+         kConnectedPeersMaxAge;
 }
 
 std::unique_ptr<network::SimpleURLLoader> IpfsService::CreateURLLoader(
@@ -238,18 +271,21 @@ void IpfsService::GetConnectedPeers(GetConnectedPeersCallback callback) {
     return;
   }
 
+  get_connected_peers_callbacks_.push_back(std::move(callback));
+  if (get_connected_peers_callbacks_.size() > 1)
+    return;
+
   auto url_loader = CreateURLLoader(server_endpoint_.Resolve(kSwarmPeersPath));
   auto iter = url_loaders_.insert(url_loaders_.begin(), std::move(url_loader));
 
   iter->get()->DownloadToStringOfUnboundedSizeUntilCrashAndDie(
       url_loader_factory_.get(),
       base::BindOnce(&IpfsService::OnGetConnectedPeers, base::Unretained(this),
-                     std::move(iter), std::move(callback)));
+                     std::move(iter)));
 }
 
 void IpfsService::OnGetConnectedPeers(
     SimpleURLLoaderList::iterator iter,
-    GetConnectedPeersCallback callback,
     std::unique_ptr<std::string> response_body) {
   auto* url_loader = iter->get();
   int error_code = url_loader->NetError();
@@ -258,16 +294,22 @@ void IpfsService::OnGetConnectedPeers(
     response_code = url_loader->ResponseInfo()->headers->response_code();
   url_loaders_.erase(iter);
 
+  std::vector<std::string> peers;
+  bool success = false;
   if (error_code != net::OK || response_code != net::HTTP_OK) {
     VLOG(1) << "Fail to get connected peers, error_code = " << error_code
             << " response_code = " << response_code;
-    std::move(callback).Run(false, std::vector<std::string>{});
-    return;
+  } else {
+    success = IPFSJSONParser::GetPeersFromJSON(*response_body, &peers);
   }
 
-  std::vector<std::string> peers;
-  bool success = IPFSJSONParser::GetPeersFromJSON(*response_body, &peers);
-  std::move(callback).Run(success, peers);
+  connected_peers_count_ = success ? peers.size() : 0;
+  connected_peers_refreshed_at_ = base::TimeTicks::Now();
+
+  std::vector<GetConnectedPeersCallback> callbacks;
+  callbacks.swap(get_connected_peers_callbacks_);
+  for (auto& callback : callbacks)
+    std::move(callback).Run(success, peers);
 }
 
 void IpfsService::GetAddressesConfig(GetAddressesConfigCallback callback) {
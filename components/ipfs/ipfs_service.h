@@ -14,6 +14,8 @@
 
 #include "base/memory/scoped_refptr.h"
 #include "base/observer_list.h"
+#include "base/time/time.h"
+#include "base/timer/timer.h"
 #include "brave/components/ipfs/addresses_config.h"
 #include "brave/components/ipfs/brave_ipfs_client_updater.h"
 #include "brave/components/ipfs/ipfs_constants.h"
@@ -64,6 +66,9 @@ class IpfsService : public KeyedService,
   void RemoveObserver(IpfsServiceObserver* observer);
 
   bool IsDaemonLaunched() const;
+  // Returns true if the last connected peers refresh found peers and is recent
+  // enough to trust without asking the daemon again.
+  bool HasFreshConnectedPeers() const;
   static void RegisterPrefs(PrefRegistrySimple* registry);
   static void RegisterLocalStatePrefs(PrefRegistrySimple* registry);
   bool IsIPFSExecutableAvailable() const;
@@ -101,13 +106,15 @@ class IpfsService : public KeyedService,
   void OnIpfsLaunched(bool result, int64_t pid);
   void OnIpfsDaemonCrashed(int64_t pid);
 
+  void RefreshConnectedPeers();
+  void ResetConnectedPeers();
+
   // Launches the ipfs service in an utility process.
   void LaunchIfNotRunning(const base::FilePath& executable_path);
 
   std::unique_ptr<network::SimpleURLLoader> CreateURLLoader(const GURL& gurl);
 
   void OnGetConnectedPeers(SimpleURLLoaderList::iterator iter,
-                           GetConnectedPeersCallback,
                            std::unique_ptr<std::string> response_body);
   void OnGetAddressesConfig(SimpleURLLoaderList::iterator iter,
                             GetAddressesConfigCallback callback,
@@ -127,6 +134,16 @@ class IpfsService : public KeyedService,
 
   LaunchDaemonCallback launch_daemon_callback_;
 
+  // Callers waiting on the in-flight swarm peers request. Concurrent callers
+  // share a single request to the daemon.
+  std::vector<GetConnectedPeersCallback> get_connected_peers_callbacks_;
+
+  // Connectivity state from the last swarm peers request, kept fresh by
+  // |connected_peers_timer_| while the daemon is running.
+  size_t connected_peers_count_ = 0;
+  base::TimeTicks connected_peers_refreshed_at_;
+  base::RepeatingTimer connected_peers_timer_;
+
   bool is_ipfs_launched_for_test_ = false;
   bool skip_get_connected_peers_callback_for_test_ = false;
   GURL server_endpoint_;
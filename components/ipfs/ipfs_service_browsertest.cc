@@ -199,6 +199,7 @@ IN_PROC_BROWSER_TEST_F(IpfsServiceBrowserTest, GetConnectedPeers) {
       base::BindOnce(&IpfsServiceBrowserTest::OnGetConnectedPeersSuccess,
                      base::Unretained(this)));
   WaitForRequest();
+  EXPECT_TRUE(ipfs_service()->HasFreshConnectedPeers());
 }
 
 IN_PROC_BROWSER_TEST_F(IpfsServiceBrowserTest, GetConnectedPeersServerError) {
@@ -209,6 +210,7 @@ IN_PROC_BROWSER_TEST_F(IpfsServiceBrowserTest, GetConnectedPeersServerError) {
       base::BindOnce(&IpfsServiceBrowserTest::OnGetConnectedPeersFail,
                      base::Unretained(this)));
   WaitForRequest();
+  EXPECT_FALSE(ipfs_service()->HasFreshConnectedPeers());
 }
 
 IN_PROC_BROWSER_TEST_F(IpfsServiceBrowserTest, GetAddressesConfig) {
@@ -0,0 +1,82 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/omnibox/browser/suffix_index.h"
+
+#include <algorithm>
+
+#include "base/logging.h"
+
+SuffixIndex::SuffixIndex(const std::vector<std::string>* strings)
+    : strings_(strings) {
+  DCHECK(strings_);
+  size_t total_length = 0;
+  for (const auto& string : *strings_)
+    total_length += string.length();
+  suffixes_.reserve(total_length);
+
+  for (size_t i = 0; i < strings_->size(); ++i) {
+    for (size_t position = 0; position < (*strings_)[i].length(); ++position) {
+      suffixes_.push_back(
+          {static_cast<uint32_t>(i), static_cast<uint32_t>(position)});
+    }
+  }
+
+  std::sort(suffixes_.begin(), suffixes_.end(),
+            [this](const Suffix& lhs, const Suffix& rhs) {
+              return SuffixText(lhs) < SuffixText(rhs);
+            });
+}
+
+SuffixIndex::~SuffixIndex() = default;
+
+base::StringPiece SuffixIndex::SuffixText(const Suffix& suffix) const {
+  return base::StringPiece((*strings_)[suffix.index]).substr(suffix.position);
+}
+
+std::vector<SuffixIndex::Match> SuffixIndex::Find(base::StringPiece needle,
+                                                  size_t max_matches) const {
+  std::vector<Match> matches;
+  if (needle.empty()) {
+    // Like std::string::find(), an empty needle matches everything.
+    const size_t count = std::min(max_matches, strings_->size());
+    for (size_t i = 0; i < count; ++i)
+      matches.push_back({i, 0});
+    return matches;
+  }
+
+  // Suffixes starting with |needle| form one contiguous range.
+  const auto begin = std::lower_bound(
+      suffixes_.begin(), suffixes_.end(), needle,
+      [this](const Suffix& suffix, base::StringPiece value) {
+        return SuffixText(suffix) < value;
+      });
+  const auto end = std::upper_bound(
+      begin, suffixes_.end(), needle,
+      [this](base::StringPiece value, const Suffix& suffix) {
+        return value < SuffixText(suffix).substr(0, value.length());
+      });
+  if (begin == end)
+    return matches;
+
+  matches.reserve(end - begin);
+  for (auto it = begin; it != end; ++it)
+    matches.push_back({it->index, it->position});
+
+  // Keep only the first occurrence per string, in list order.
+  std::sort(matches.begin(), matches.end(),
+            [](const Match& lhs, const Match& rhs) {
+              return lhs.index != rhs.index ? lhs.index < rhs.index
+                                            : lhs.position < rhs.position;
+            });
+  matches.erase(std::unique(matches.begin(), matches.end(),
+                            [](const Match& lhs, const Match& rhs) {
+                              return lhs.index == rhs.index;
+                            }),
+                matches.end());
+  if (matches.size() > max_matches)
+    matches.resize(max_matches);
+  return matches;
+}
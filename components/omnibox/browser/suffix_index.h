@@ -0,0 +1,52 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_OMNIBOX_BROWSER_SUFFIX_INDEX_H_
+#define BRAVE_COMPONENTS_OMNIBOX_BROWSER_SUFFIX_INDEX_H_
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "base/macros.h"
+#include "base/strings/string_piece.h"
+
+// Substring index over a fixed list of strings. Every suffix of every string
+// is kept in a sorted array, so finding the strings that contain a needle is
+// a binary search instead of a scan over the whole list.
+class SuffixIndex {
+ public:
+  struct Match {
+    // Position of the matching string in the indexed list.
+    size_t index;
+    // Offset of the first occurrence of the needle in that string.
+    size_t position;
+  };
+
+  // |strings| must outlive the index and must not change.
+  explicit SuffixIndex(const std::vector<std::string>* strings);
+  ~SuffixIndex();
+
+  // Returns up to |max_matches| strings containing |needle|, in the order
+  // they appear in the indexed list.
+  std::vector<Match> Find(base::StringPiece needle, size_t max_matches) const;
+
+ private:
+  struct Suffix {
+    uint32_t index;
+    uint32_t position;
+  };
+
+  base::StringPiece SuffixText(const Suffix& suffix) const;
+
+  const std::vector<std::string>* strings_;
+  // Sorted by suffix text.
+  std::vector<Suffix> suffixes_;
+
+  DISALLOW_COPY_AND_ASSIGN(SuffixIndex);
+};
+
+#endif  // BRAVE_COMPONENTS_OMNIBOX_BROWSER_SUFFIX_INDEX_H_
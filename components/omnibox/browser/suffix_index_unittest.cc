@@ -0,0 +1,76 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/omnibox/browser/suffix_index.h"
+
+#include <string>
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+// npm run test -- brave_unit_tests --filter=SuffixIndexTest.*
+
+namespace {
+
+// Reference implementation: the linear scan the index replaces.
+std::vector<SuffixIndex::Match> FindByScan(
+    const std::vector<std::string>& strings,
+    const std::string& needle,
+    size_t max_matches) {
+  std::vector<SuffixIndex::Match> matches;
+  for (size_t i = 0; i < strings.size() && matches.size() < max_matches;
+       ++i) {
+    const size_t position = strings[i].find(needle);
+    if (position != std::string::npos)
+      matches.push_back({i, position});
+  }
+  return matches;
+}
+
+void ExpectSameMatches(const std::vector<SuffixIndex::Match>& expected,
+                       const std::vector<SuffixIndex::Match>& actual) {
+  ASSERT_EQ(expected.size(), actual.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(expected[i].index, actual[i].index);
+    EXPECT_EQ(expected[i].position, actual[i].position);
+  }
+}
+
+}  // namespace
+
+TEST(SuffixIndexTest, MatchesLinearScan) {
+  const std::vector<std::string> sites = {
+      "google.com",     "gmail.com",  "mail.google.com", "maps.google.com",
+      "facebook.com",   "youtube.com", "amazon.com",     "amazon.ca",
+      "google.co.in",   "ebay.com",   "go.com",          "oogle.org",
+  };
+  const SuffixIndex index(&sites);
+
+  for (const std::string needle :
+       {"g", "go", "goo", "google", "oo", "mail", ".com", "com", "a", "amazon.",
+        "zzz", "google.com", "mail.google.com", "x"}) {
+    for (size_t max_matches : {1, 3, 100}) {
+      ExpectSameMatches(FindByScan(sites, needle, max_matches),
+                        index.Find(needle, max_matches));
+    }
+  }
+}
+
+TEST(SuffixIndexTest, ReportsFirstOccurrence) {
+  const std::vector<std::string> sites = {"abab.ab"};
+  const SuffixIndex index(&sites);
+
+  const auto matches = index.Find("ab", 10);
+  ASSERT_EQ(1u, matches.size());
+  EXPECT_EQ(0u, matches[0].index);
+  EXPECT_EQ(0u, matches[0].position);
+}
+
+TEST(SuffixIndexTest, NeedleLongerThanEntries) {
+  const std::vector<std::string> sites = {"a.com", "b.com"};
+  const SuffixIndex index(&sites);
+
+  EXPECT_TRUE(index.Find("a.com.au", 10).empty());
+}
@@ -8,6 +8,7 @@
 #include <algorithm>
 #include <utility>
 
+#include "base/no_destructor.h"
 #include "base/strings/string_util.h"
 #include "base/strings/utf_string_conversions.h"
 #include "brave/common/pref_names.h"
@@ -41,28 +42,58 @@ void SuggestedSitesProvider::Start(const AutocompleteInput& input,
 
   const std::string input_text =
       base::ToLowerASCII(base::UTF16ToUTF8(input.text()));
-  auto check_add_match =
-      [&](const SuggestedSitesMatch& match) {
+  const auto& suggested_sites = GetSuggestedSites();
+  const auto& sorted_sites = GetSuggestedSitesByMatchString();
+
+  // We only want people that really want these suggestions, so the input has
+  // to be a prefix of the match string. Example don't suggest bitcoin and
+  // litecoin for just a coin search. All such match strings sort right after
+  // the first one not less than the input.
+  auto less_than_text = [&](size_t index, const std::string& text) {
+    return suggested_sites[index].match_string_ < text;
+  };
+  std::vector<size_t> found;
+  for (auto it = std::lower_bound(sorted_sites.begin(), sorted_sites.end(),
+                                  input_text, less_than_text);
+       it != sorted_sites.end(); ++it) {
+    const std::string& match_string = suggested_sites[*it].match_string_;
+    if (!base::StartsWith(match_string, input_text,
+                          base::CompareCase::SENSITIVE)) {
+      break;
+    }
     // Don't bother matching until 4 chars, or less if it's an exact match
     if (input_text.length() < 4 &&
-        match.match_string_.length() != input_text.length()) {
-      return;
-    }
-    size_t foundPos = match.match_string_.find(input_text);
-    // We'd normally check for npos here but we want only people that
-    // really want these suggestions. Example don't suggest bitcoin and
-    // litecoin for just a coin search.
-    if (foundPos == 0) {
-      ACMatchClassifications styles =
-          StylesForSingleMatch(input_text,
-              base::UTF16ToASCII(match.display_));
-      AddMatch(match, styles);
+        match_string.length() != input_text.length()) {
+      continue;
     }
-  };
+    found.push_back(*it);
+  }
+
+  // Keep the order of the suggested sites list.
+  std::sort(found.begin(), found.end());
+  for (size_t index : found) {
+    const SuggestedSitesMatch& match = suggested_sites[index];
+    ACMatchClassifications styles =
+        StylesForSingleMatch(input_text, base::UTF16ToASCII(match.display_));
+    AddMatch(match, styles);
+  }
+}
 
+const std::vector<size_t>&
+SuggestedSitesProvider::GetSuggestedSitesByMatchString() {
   const auto& suggested_sites = GetSuggestedSites();
-  std::for_each(suggested_sites.begin(), suggested_sites.end(),
-      check_add_match);
+  static const base::NoDestructor<std::vector<size_t>> sorted_sites([&]() {
+    std::vector<size_t> indices(suggested_sites.size());
+    for (size_t i = 0; i < indices.size(); ++i)
+      indices[i] = i;
+    std::stable_sort(indices.begin(), indices.end(),
+                     [&](size_t lhs, size_t rhs) {
+                       return suggested_sites[lhs].match_string_ <
+                              suggested_sites[rhs].match_string_;
+                     });
+    return indices;
+  }());
+  return *sorted_sites;
 }
 
 SuggestedSitesProvider::~SuggestedSitesProvider() {}
@@ -32,6 +32,9 @@ class SuggestedSitesProvider : public AutocompleteProvider {
   static const int kRelevance;
 
   const std::vector<SuggestedSitesMatch>& GetSuggestedSites();
+  // Indices into GetSuggestedSites() sorted by match string, built on first
+  // use so prefix lookups are a binary search.
+  const std::vector<size_t>& GetSuggestedSitesByMatchString();
   void AddMatch(const SuggestedSitesMatch& match,
                 const ACMatchClassifications& styles);
 
@@ -16,6 +16,7 @@
 #include "components/omnibox/browser/autocomplete_provider.h"
 
 class AutocompleteProviderClient;
+class SuffixIndex;
 
 // This is the provider for top Alexa 500 sites URLs
 class TopSitesProvider : public AutocompleteProvider {
@@ -32,6 +33,9 @@ class TopSitesProvider : public AutocompleteProvider {
 
   static std::vector<std::string> top_sites_;
 
+  // Built from |top_sites_| on first use.
+  static const SuffixIndex& GetTopSitesIndex();
+
   void AddMatch(const base::string16& match_string,
                 const ACMatchClassifications& styles);
 
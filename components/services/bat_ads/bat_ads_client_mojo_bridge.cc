@@ -12,6 +12,7 @@
 #include "mojo/public/cpp/bindings/interface_request.h"
 #include "mojo/public/cpp/bindings/sync_call_restrictions.h"
 #include "base/logging.h"
+#include "base/strings/number_conversions.h"
 
 namespace bat_ads {
 
@@ -243,7 +244,13 @@ bool BatAdsClientMojoBridge::GetBooleanPref(
     return value;
   }
 
+  const auto iter = prefs_.find(path);
+  if (iter != prefs_.end() && iter->second.is_bool()) {
+    return iter->second.GetBool();
+  }
+
   bat_ads_client_->GetBooleanPref(path, &value);
+  prefs_[path] = base::Value(value);
   return value;
 }
 
@@ -254,6 +261,7 @@ void BatAdsClientMojoBridge::SetBooleanPref(
     return;
   }
 
+  prefs_[path] = base::Value(value);
   bat_ads_client_->SetBooleanPref(path, value);
 }
 
@@ -265,7 +273,13 @@ int BatAdsClientMojoBridge::GetIntegerPref(
     return value;
   }
 
+  const auto iter = prefs_.find(path);
+  if (iter != prefs_.end() && iter->second.is_int()) {
+    return iter->second.GetInt();
+  }
+
   bat_ads_client_->GetIntegerPref(path, &value);
+  prefs_[path] = base::Value(value);
   return value;
 }
 
@@ -276,6 +290,7 @@ void BatAdsClientMojoBridge::SetIntegerPref(
     return;
   }
 
+  prefs_[path] = base::Value(value);
   bat_ads_client_->SetIntegerPref(path, value);
 }
 
@@ -287,7 +302,13 @@ double BatAdsClientMojoBridge::GetDoublePref(
     return value;
   }
 
+  const auto iter = prefs_.find(path);
+  if (iter != prefs_.end() && iter->second.is_double()) {
+    return iter->second.GetDouble();
+  }
+
   bat_ads_client_->GetDoublePref(path, &value);
+  prefs_[path] = base::Value(value);
   return value;
 }
 
@@ -298,6 +319,7 @@ void BatAdsClientMojoBridge::SetDoublePref(
     return;
   }
 
+  prefs_[path] = base::Value(value);
   bat_ads_client_->SetDoublePref(path, value);
 }
 
@@ -309,7 +331,13 @@ std::string BatAdsClientMojoBridge::GetStringPref(
     return value;
   }
 
+  const auto iter = prefs_.find(path);
+  if (iter != prefs_.end() && iter->second.is_string()) {
+    return iter->second.GetString();
+  }
+
   bat_ads_client_->GetStringPref(path, &value);
+  prefs_[path] = base::Value(value);
   return value;
 }
 
@@ -320,6 +348,7 @@ void BatAdsClientMojoBridge::SetStringPref(
     return;
   }
 
+  prefs_[path] = base::Value(value);
   bat_ads_client_->SetStringPref(path, value);
 }
 
@@ -331,7 +360,15 @@ int64_t BatAdsClientMojoBridge::GetInt64Pref(
     return value;
   }
 
+  // 64-bit integers do not fit in a base::Value so are cached as strings
+  const auto iter = prefs_.find(path);
+  if (iter != prefs_.end() && iter->second.is_string() &&
+      base::StringToInt64(iter->second.GetString(), &value)) {
+    return value;
+  }
+
   bat_ads_client_->GetInt64Pref(path, &value);
+  prefs_[path] = base::Value(base::NumberToString(value));
   return value;
 }
 
@@ -342,6 +379,7 @@ void BatAdsClientMojoBridge::SetInt64Pref(
     return;
   }
 
+  prefs_[path] = base::Value(base::NumberToString(value));
   bat_ads_client_->SetInt64Pref(path, value);
 }
 
@@ -353,7 +391,15 @@ uint64_t BatAdsClientMojoBridge::GetUint64Pref(
     return value;
   }
 
+  // 64-bit integers do not fit in a base::Value so are cached as strings
+  const auto iter = prefs_.find(path);
+  if (iter != prefs_.end() && iter->second.is_string() &&
+      base::StringToUint64(iter->second.GetString(), &value)) {
+    return value;
+  }
+
   bat_ads_client_->GetUint64Pref(path, &value);
+  prefs_[path] = base::Value(base::NumberToString(value));
   return value;
 }
 
@@ -364,6 +410,7 @@ void BatAdsClientMojoBridge::SetUint64Pref(
     return;
   }
 
+  prefs_[path] = base::Value(base::NumberToString(value));
   bat_ads_client_->SetUint64Pref(path, value);
 }
 
@@ -373,9 +420,15 @@ void BatAdsClientMojoBridge::ClearPref(
     return;
   }
 
+  prefs_.erase(path);
   bat_ads_client_->ClearPref(path);
 }
 
+void BatAdsClientMojoBridge::OnPrefChanged(
+    const std::string& path) {
+  prefs_.erase(path);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 bool BatAdsClientMojoBridge::connected() const {
@@ -6,10 +6,12 @@
 #ifndef BRAVE_COMPONENTS_SERVICES_BAT_ADS_BAT_ADS_CLIENT_MOJO_BRIDGE_H_
 #define BRAVE_COMPONENTS_SERVICES_BAT_ADS_BAT_ADS_CLIENT_MOJO_BRIDGE_H_
 
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
 
+#include "base/values.h"
 #include "bat/ads/ads_client.h"
 #include "brave/components/services/bat_ads/public/interfaces/bat_ads.mojom.h"
 #include "mojo/public/cpp/bindings/associated_remote.h"
@@ -122,10 +124,18 @@ class BatAdsClientMojoBridge
   void ClearPref(
       const std::string& path) override;
 
+  // Drops the cached value for |path| after it was changed by the browser
+  void OnPrefChanged(
+      const std::string& path);
+
  private:
   bool connected() const;
 
   mojo::AssociatedRemote<mojom::BatAdsClient> bat_ads_client_;
+
+  // Prefs read from or written to the browser, so that repeated reads do not
+  // block on a sync IPC. Invalidated by OnPrefChanged()
+  mutable std::map<std::string, base::Value> prefs_;
 };
 
 }  // namespace bat_ads
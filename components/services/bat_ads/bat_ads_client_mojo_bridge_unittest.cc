@@ -0,0 +1,147 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/services/bat_ads/bat_ads_client_mojo_bridge.h"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "base/logging.h"
+#include "base/run_loop.h"
+#include "base/test/task_environment.h"
+#include "bat/ads/pref_names.h"
+#include "mojo/public/cpp/bindings/associated_receiver.h"
+#include "mojo/public/cpp/bindings/associated_remote.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+// npm run test -- brave_unit_tests --filter=BatAdsClientMojoBridgeTest.*
+
+namespace bat_ads {
+
+namespace {
+
+// Written both by bat ads and directly by the browser
+const char* const kPrefPath =
+    ads::prefs::kAutoDetectedAdsSubdivisionTargetingCode;
+
+// Stands in for the browser, which owns the prefs
+class FakeBatAdsClient : public mojom::BatAdsClientInterceptorForTesting {
+ public:
+  FakeBatAdsClient() = default;
+  ~FakeBatAdsClient() override = default;
+
+  mojom::BatAdsClient* GetForwardingInterface() override {
+    NOTREACHED();
+    return nullptr;
+  }
+
+  void GetStringPref(
+      const std::string& path,
+      GetStringPrefCallback callback) override {
+    get_string_pref_count_++;
+    std::move(callback).Run(prefs_[path]);
+  }
+
+  void SetStringPref(
+      const std::string& path,
+      const std::string& value) override {
+    prefs_[path] = value;
+  }
+
+  void ClearPref(
+      const std::string& path) override {
+    prefs_.erase(path);
+  }
+
+  std::map<std::string, std::string> prefs_;
+  int get_string_pref_count_ = 0;
+};
+
+}  // namespace
+
+class BatAdsClientMojoBridgeTest : public ::testing::Test {
+ protected:
+  BatAdsClientMojoBridgeTest() {
+    mojo::AssociatedRemote<mojom::BatAdsClient> remote;
+    receiver_.Bind(remote.BindNewEndpointAndPassDedicatedReceiver());
+    bridge_ = std::make_unique<BatAdsClientMojoBridge>(remote.Unbind());
+  }
+
+  // Simulates a write by the browser which did not come from bat ads
+  void SetStringPrefInBrowser(
+      const std::string& path,
+      const std::string& value) {
+    client_.prefs_[path] = value;
+    bridge_->OnPrefChanged(path);
+  }
+
+  base::test::TaskEnvironment task_environment_;
+  FakeBatAdsClient client_;
+  mojo::AssociatedReceiver<mojom::BatAdsClient> receiver_{&client_};
+  std::unique_ptr<BatAdsClientMojoBridge> bridge_;
+};
+
+TEST_F(BatAdsClientMojoBridgeTest,
+    CacheReads) {
+  // Arrange
+  client_.prefs_[kPrefPath] = "US-FL";
+
+  // Act
+  bridge_->GetStringPref(kPrefPath);
+  const std::string value = bridge_->GetStringPref(kPrefPath);
+
+  // Assert
+  EXPECT_EQ("US-FL", value);
+  EXPECT_EQ(1, client_.get_string_pref_count_);
+}
+
+TEST_F(BatAdsClientMojoBridgeTest,
+    InvalidateCachedReadWhenPrefChanged) {
+  // Arrange
+  client_.prefs_[kPrefPath] = "US-FL";
+  bridge_->GetStringPref(kPrefPath);
+
+  // Act
+  SetStringPrefInBrowser(kPrefPath, "US-CA");
+
+  // Assert
+  EXPECT_EQ("US-CA", bridge_->GetStringPref(kPrefPath));
+  EXPECT_EQ(2, client_.get_string_pref_count_);
+}
+
+TEST_F(BatAdsClientMojoBridgeTest,
+    InvalidateCachedWriteWhenPrefChanged) {
+  // Arrange
+  bridge_->SetStringPref(kPrefPath, "US-FL");
+  base::RunLoop().RunUntilIdle();
+  ASSERT_EQ("US-FL", client_.prefs_[kPrefPath]);
+  ASSERT_EQ("US-FL", bridge_->GetStringPref(kPrefPath));
+  ASSERT_EQ(0, client_.get_string_pref_count_);
+
+  // Act
+  SetStringPrefInBrowser(kPrefPath, "US-CA");
+
+  // Assert
+  EXPECT_EQ("US-CA", bridge_->GetStringPref(kPrefPath));
+  EXPECT_EQ(1, client_.get_string_pref_count_);
+}
+
+TEST_F(BatAdsClientMojoBridgeTest,
+    InvalidateCacheWhenClearingPref) {
+  // Arrange
+  bridge_->SetStringPref(kPrefPath, "US-FL");
+
+  // Act
+  bridge_->ClearPref(kPrefPath);
+  base::RunLoop().RunUntilIdle();
+
+  // Assert
+  EXPECT_EQ("", bridge_->GetStringPref(kPrefPath));
+  EXPECT_EQ(1, client_.get_string_pref_count_);
+}
+
+}  // namespace bat_ads
@@ -243,6 +243,11 @@ void BatAdsImpl::OnUserModelUpdated(
   ads_->OnUserModelUpdated(id);
 }
 
+void BatAdsImpl::OnPrefChanged(
+    const std::string& path) {
+  bat_ads_client_mojo_proxy_->OnPrefChanged(path);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 void BatAdsImpl::OnInitialize(
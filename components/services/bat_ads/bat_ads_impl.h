@@ -134,6 +134,9 @@ class BatAdsImpl :
   void OnUserModelUpdated(
       const std::string& id) override;
 
+  void OnPrefChanged(
+      const std::string& path) override;
+
  private:
   // Workaround to pass base::OnceCallback into std::bind
   template <typename Callback>
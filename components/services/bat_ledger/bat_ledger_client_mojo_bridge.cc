@@ -11,6 +11,7 @@
 #include <vector>
 
 #include "base/logging.h"
+#include "base/strings/number_conversions.h"
 #include "brave/base/containers/utils.h"
 
 namespace bat_ledger {
@@ -151,116 +152,195 @@ void BatLedgerClientMojoBridge::PublisherListNormalized(
 
 void BatLedgerClientMojoBridge::SetBooleanState(const std::string& name,
                                                bool value) {
+  state_[name] = base::Value(value);
   bat_ledger_client_->SetBooleanState(name, value);
 }
 
 bool BatLedgerClientMojoBridge::GetBooleanState(const std::string& name) const {
+  const auto iter = state_.find(name);
+  if (iter != state_.end() && iter->second.is_bool())
+    return iter->second.GetBool();
+
   bool value;
   bat_ledger_client_->GetBooleanState(name, &value);
+  state_[name] = base::Value(value);
   return value;
 }
 
 void BatLedgerClientMojoBridge::SetIntegerState(const std::string& name,
                                                int value) {
+  state_[name] = base::Value(value);
   bat_ledger_client_->SetIntegerState(name, value);
 }
 
 int BatLedgerClientMojoBridge::GetIntegerState(const std::string& name) const {
+  const auto iter = state_.find(name);
+  if (iter != state_.end() && iter->second.is_int())
+    return iter->second.GetInt();
+
   int value;
   bat_ledger_client_->GetIntegerState(name, &value);
+  state_[name] = base::Value(value);
   return value;
 }
 
 void BatLedgerClientMojoBridge::SetDoubleState(const std::string& name,
                                               double value) {
+  state_[name] = base::Value(value);
   bat_ledger_client_->SetDoubleState(name, value);
 }
 
 double BatLedgerClientMojoBridge::GetDoubleState(
     const std::string& name) const {
+  const auto iter = state_.find(name);
+  if (iter != state_.end() && iter->second.is_double())
+    return iter->second.GetDouble();
+
   double value;
   bat_ledger_client_->GetDoubleState(name, &value);
+  state_[name] = base::Value(value);
   return value;
 }
 
 void BatLedgerClientMojoBridge::SetStringState(const std::string& name,
                               const std::string& value) {
+  state_[name] = base::Value(value);
   bat_ledger_client_->SetStringState(name, value);
 }
 
 std::string BatLedgerClientMojoBridge::
 GetStringState(const std::string& name) const {
+  const auto iter = state_.find(name);
+  if (iter != state_.end() && iter->second.is_string())
+    return iter->second.GetString();
+
   std::string value;
   bat_ledger_client_->GetStringState(name, &value);
+  state_[name] = base::Value(value);
   return value;
 }
 
 void BatLedgerClientMojoBridge::SetInt64State(const std::string& name,
                                              int64_t value) {
+  state_[name] = base::Value(base::NumberToString(value));
   bat_ledger_client_->SetInt64State(name, value);
 }
 
 int64_t BatLedgerClientMojoBridge::GetInt64State(
     const std::string& name) const {
+  const auto iter = state_.find(name);
   int64_t value;
+  if (iter != state_.end() && iter->second.is_string() &&
+      base::StringToInt64(iter->second.GetString(), &value)) {
+    return value;
+  }
+
   bat_ledger_client_->GetInt64State(name, &value);
+  state_[name] = base::Value(base::NumberToString(value));
   return value;
 }
 
 void BatLedgerClientMojoBridge::SetUint64State(const std::string& name,
                                               uint64_t value) {
+  state_[name] = base::Value(base::NumberToString(value));
   bat_ledger_client_->SetUint64State(name, value);
 }
 
 uint64_t BatLedgerClientMojoBridge::GetUint64State(
     const std::string& name) const {
+  const auto iter = state_.find(name);
   uint64_t value;
+  if (iter != state_.end() && iter->second.is_string() &&
+      base::StringToUint64(iter->second.GetString(), &value)) {
+    return value;
+  }
+
   bat_ledger_client_->GetUint64State(name, &value);
+  state_[name] = base::Value(base::NumberToString(value));
   return value;
 }
 
 void BatLedgerClientMojoBridge::ClearState(const std::string& name) {
+  state_.erase(name);
   bat_ledger_client_->ClearState(name);
 }
 
+void BatLedgerClientMojoBridge::OnStateChanged(const std::string& name) {
+  state_.erase(name);
+}
+
 bool BatLedgerClientMojoBridge::GetBooleanOption(
     const std::string& name) const {
+  const auto iter = options_.find(name);
+  if (iter != options_.end() && iter->second.is_bool())
+    return iter->second.GetBool();
+
   bool value;
   bat_ledger_client_->GetBooleanOption(name, &value);
+  options_[name] = base::Value(value);
   return value;
 }
 
 int BatLedgerClientMojoBridge::GetIntegerOption(const std::string& name) const {
+  const auto iter = options_.find(name);
+  if (iter != options_.end() && iter->second.is_int())
+    return iter->second.GetInt();
+
   int value;
   bat_ledger_client_->GetIntegerOption(name, &value);
+  options_[name] = base::Value(value);
   return value;
 }
 
 double BatLedgerClientMojoBridge::GetDoubleOption(
     const std::string& name) const {
+  const auto iter = options_.find(name);
+  if (iter != options_.end() && iter->second.is_double())
+    return iter->second.GetDouble();
+
   double value;
   bat_ledger_client_->GetDoubleOption(name, &value);
+  options_[name] = base::Value(value);
   return value;
 }
 
 std::string BatLedgerClientMojoBridge::GetStringOption(
     const std::string& name) const {
+  const auto iter = options_.find(name);
+  if (iter != options_.end() && iter->second.is_string())
+    return iter->second.GetString();
+
   std::string value;
   bat_ledger_client_->GetStringOption(name, &value);
+  options_[name] = base::Value(value);
   return value;
 }
 
 int64_t BatLedgerClientMojoBridge::GetInt64Option(
     const std::string& name) const {
+  const auto iter = options_.find(name);
   int64_t value;
+  if (iter != options_.end() && iter->second.is_string() &&
+      base::StringToInt64(iter->second.GetString(), &value)) {
+    return value;
+  }
+
   bat_ledger_client_->GetInt64Option(name, &value);
+  options_[name] = base::Value(base::NumberToString(value));
   return value;
 }
 
 uint64_t BatLedgerClientMojoBridge::GetUint64Option(
     const std::string& name) const {
+  const auto iter = options_.find(name);
   uint64_t value;
+  if (iter != options_.end() && iter->second.is_string() &&
+      base::StringToUint64(iter->second.GetString(), &value)) {
+    return value;
+  }
+
   bat_ledger_client_->GetUint64Option(name, &value);
+  options_[name] = base::Value(base::NumberToString(value));
   return value;
 }
 
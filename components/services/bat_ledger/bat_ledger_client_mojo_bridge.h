@@ -12,6 +12,7 @@
 #include <vector>
 
 #include "base/memory/weak_ptr.h"
+#include "base/values.h"
 #include "bat/ledger/ledger_client.h"
 #include "brave/components/services/bat_ledger/public/interfaces/bat_ledger.mojom.h"
 #include "mojo/public/cpp/bindings/associated_remote.h"
@@ -73,6 +74,9 @@ class BatLedgerClientMojoBridge :
   uint64_t GetUint64State(const std::string& name) const override;
   void ClearState(const std::string& name) override;
 
+  // Drops the cached value for |name| after it was changed by the browser
+  void OnStateChanged(const std::string& name);
+
   bool GetBooleanOption(const std::string& name) const override;
   int GetIntegerOption(const std::string& name) const override;
   double GetDoubleOption(const std::string& name) const override;
@@ -128,6 +132,12 @@ class BatLedgerClientMojoBridge :
   bool Connected() const;
 
   mojo::AssociatedRemote<mojom::BatLedgerClient> bat_ledger_client_;
+
+  // Values read from or written to the browser, so that repeated reads do not
+  // block on a sync IPC. State is invalidated by OnStateChanged(), options
+  // never change while the ledger is running
+  mutable std::map<std::string, base::Value> state_;
+  mutable std::map<std::string, base::Value> options_;
 };
 
 }  // namespace bat_ledger
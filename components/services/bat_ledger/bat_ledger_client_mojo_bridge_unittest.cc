@@ -0,0 +1,124 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/services/bat_ledger/bat_ledger_client_mojo_bridge.h"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "base/logging.h"
+#include "base/run_loop.h"
+#include "base/test/task_environment.h"
+#include "mojo/public/cpp/bindings/associated_receiver.h"
+#include "mojo/public/cpp/bindings/associated_remote.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+// npm run test -- brave_unit_tests --filter=BatLedgerClientMojoBridgeTest.*
+
+namespace bat_ledger {
+
+namespace {
+
+const char kStateName[] = "state_name";
+
+// Stands in for the browser, which owns the state
+class FakeBatLedgerClient : public mojom::BatLedgerClientInterceptorForTesting {
+ public:
+  FakeBatLedgerClient() = default;
+  ~FakeBatLedgerClient() override = default;
+
+  mojom::BatLedgerClient* GetForwardingInterface() override {
+    NOTREACHED();
+    return nullptr;
+  }
+
+  void GetStringState(
+      const std::string& name,
+      GetStringStateCallback callback) override {
+    get_string_state_count_++;
+    std::move(callback).Run(state_[name]);
+  }
+
+  void SetStringState(
+      const std::string& name,
+      const std::string& value) override {
+    state_[name] = value;
+  }
+
+  void ClearState(const std::string& name) override {
+    state_.erase(name);
+  }
+
+  std::map<std::string, std::string> state_;
+  int get_string_state_count_ = 0;
+};
+
+}  // namespace
+
+class BatLedgerClientMojoBridgeTest : public ::testing::Test {
+ protected:
+  BatLedgerClientMojoBridgeTest() {
+    mojo::AssociatedRemote<mojom::BatLedgerClient> remote;
+    receiver_.Bind(remote.BindNewEndpointAndPassDedicatedReceiver());
+    bridge_ = std::make_unique<BatLedgerClientMojoBridge>(remote.Unbind());
+  }
+
+  // Simulates a write by the browser which did not come from the ledger
+  void SetStringStateInBrowser(
+      const std::string& name,
+      const std::string& value) {
+    client_.state_[name] = value;
+    bridge_->OnStateChanged(name);
+  }
+
+  base::test::TaskEnvironment task_environment_;
+  FakeBatLedgerClient client_;
+  mojo::AssociatedReceiver<mojom::BatLedgerClient> receiver_{&client_};
+  std::unique_ptr<BatLedgerClientMojoBridge> bridge_;
+};
+
+TEST_F(BatLedgerClientMojoBridgeTest, ReadsAreCached) {
+  client_.state_[kStateName] = "value";
+
+  EXPECT_EQ("value", bridge_->GetStringState(kStateName));
+  EXPECT_EQ("value", bridge_->GetStringState(kStateName));
+  EXPECT_EQ(1, client_.get_string_state_count_);
+}
+
+TEST_F(BatLedgerClientMojoBridgeTest, StateChangedInvalidatesRead) {
+  client_.state_[kStateName] = "value";
+  EXPECT_EQ("value", bridge_->GetStringState(kStateName));
+
+  SetStringStateInBrowser(kStateName, "browser_value");
+
+  EXPECT_EQ("browser_value", bridge_->GetStringState(kStateName));
+  EXPECT_EQ(2, client_.get_string_state_count_);
+}
+
+TEST_F(BatLedgerClientMojoBridgeTest, StateChangedInvalidatesWrite) {
+  bridge_->SetStringState(kStateName, "value");
+  base::RunLoop().RunUntilIdle();
+  EXPECT_EQ("value", client_.state_[kStateName]);
+  EXPECT_EQ("value", bridge_->GetStringState(kStateName));
+  EXPECT_EQ(0, client_.get_string_state_count_);
+
+  SetStringStateInBrowser(kStateName, "browser_value");
+
+  EXPECT_EQ("browser_value", bridge_->GetStringState(kStateName));
+  EXPECT_EQ(1, client_.get_string_state_count_);
+}
+
+TEST_F(BatLedgerClientMojoBridgeTest, ClearStateInvalidatesCache) {
+  bridge_->SetStringState(kStateName, "value");
+  bridge_->ClearState(kStateName);
+  base::RunLoop().RunUntilIdle();
+
+  EXPECT_EQ("", bridge_->GetStringState(kStateName));
+  EXPECT_EQ(1, client_.get_string_state_count_);
+}
+
+}  // namespace bat_ledger
@@ -1153,4 +1153,8 @@ void BatLedgerImpl::GetWalletPassphrase(GetWalletPassphraseCallback callback) {
   std::move(callback).Run(ledger_->GetWalletPassphrase());
 }
 
+void BatLedgerImpl::OnStateChanged(const std::string& name) {
+  bat_ledger_client_mojo_bridge_->OnStateChanged(name);
+}
+
 }  // namespace bat_ledger
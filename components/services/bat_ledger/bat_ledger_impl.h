@@ -247,6 +247,8 @@ class BatLedgerImpl :
 
   void GetWalletPassphrase(GetWalletPassphraseCallback callback) override;
 
+  void OnStateChanged(const std::string& name) override;
+
  private:
   // workaround to pass base::OnceCallback into std::bind
   template <typename Callback>
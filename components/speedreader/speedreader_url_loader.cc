@@ -12,6 +12,7 @@
 #include "base/bind.h"
 #include "base/metrics/histogram_macros.h"
 #include "base/task/post_task.h"
+#include "base/timer/elapsed_timer.h"
 #include "brave/components/speedreader/rust/ffi/speedreader.h"
 #include "brave/components/speedreader/speedreader_rewriter_service.h"
 #include "brave/components/speedreader/speedreader_throttle.h"
@@ -24,8 +25,65 @@ namespace {
 
 constexpr uint32_t kReadBufferSize = 32768;
 
+// Reading from the source loader is paused while more than this many bytes
+// are waiting to be consumed by the distiller.
+constexpr size_t kMaxBytesInFlight = 8 * kReadBufferSize;
+
+// Bodies larger than this are passed through untouched.
+constexpr size_t kMaxDistillableBodySize = 16 * 1024 * 1024;
+
+// TODO(brave-browser/issues/10372): would be better to pass explicit signal
+// back from rewriter to indicate if content was found.
+constexpr size_t kMinDistilledSize = 1024;
+
 }  // namespace
 
+// Owns the rewriter and is only used on the distill sequence. Chunks are
+// pumped into the rewriter as they are received; the output is only known
+// once the whole document has been seen.
+class SpeedReaderURLLoader::Distiller {
+ public:
+  Distiller(std::unique_ptr<Rewriter> rewriter, const std::string& stylesheet)
+      : rewriter_(std::move(rewriter)), stylesheet_(stylesheet) {}
+
+  Distiller(const Distiller&) = delete;
+  Distiller& operator=(const Distiller&) = delete;
+
+  void Write(base::StringPiece chunk) {
+    if (failed_)
+      return;
+    base::ElapsedTimer timer;
+    // Non-zero means an error occurred.
+    failed_ = rewriter_->Write(chunk.data(), chunk.size()) != 0;
+    elapsed_ += timer.Elapsed();
+  }
+
+  // Returns the distilled page or an empty string if the page could not be
+  // distilled.
+  std::string Finish() {
+    if (failed_)
+      return std::string();
+
+    base::ElapsedTimer timer;
+    if (rewriter_->End() != 0)
+      return std::string();
+    const std::string& transformed = rewriter_->GetOutput();
+    elapsed_ += timer.Elapsed();
+    UMA_HISTOGRAM_TIMES("Brave.Speedreader.Distill", elapsed_);
+
+    if (transformed.length() < kMinDistilledSize)
+      return std::string();
+
+    return stylesheet_ + transformed;
+  }
+
+ private:
+  std::unique_ptr<Rewriter> rewriter_;
+  const std::string stylesheet_;
+  bool failed_ = false;
+  base::TimeDelta elapsed_;
+};
+
 // static
 std::tuple<mojo::PendingRemote<network::mojom::URLLoader>,
            mojo::PendingReceiver<network::mojom::URLLoaderClient>,
@@ -68,9 +126,19 @@ SpeedReaderURLLoader::SpeedReaderURLLoader(
       body_producer_watcher_(FROM_HERE,
                              mojo::SimpleWatcher::ArmingPolicy::MANUAL,
                              std::move(task_runner)),
+      distill_task_runner_(base::CreateSequencedTaskRunner(
+          {base::ThreadPool(), base::TaskPriority::USER_BLOCKING})),
+      distiller_(nullptr, base::OnTaskRunnerDeleter(distill_task_runner_)),
       rewriter_service_(rewriter_service) {}
 
-SpeedReaderURLLoader::~SpeedReaderURLLoader() = default;
+SpeedReaderURLLoader::~SpeedReaderURLLoader() {
+  // Chunks which have not been distilled yet still point into the body, so
+  // it is deleted on the distill sequence after them.
+  if (bytes_in_flight_ > 0) {
+    distill_task_runner_->DeleteSoon(
+        FROM_HERE, std::make_unique<std::string>(std::move(buffered_body_)));
+  }
+}
 
 void SpeedReaderURLLoader::Start(
     mojo::PendingRemote<network::mojom::URLLoader> source_url_loader_remote,
@@ -118,6 +186,12 @@ void SpeedReaderURLLoader::OnStartLoadingResponseBody(
     mojo::ScopedDataPipeConsumerHandle body) {
   VLOG(2) << __func__ << " " << response_url_;
   state_ = State::kLoading;
+  body_start_time_ = base::TimeTicks::Now();
+  if (rewriter_service_) {
+    distiller_.reset(
+        new Distiller(rewriter_service_->MakeRewriter(response_url_),
+                      rewriter_service_->GetContentStylesheet()));
+  }
   body_consumer_handle_ = std::move(body);
   body_consumer_watcher_.Watch(
       body_consumer_handle_.get(),
@@ -190,6 +264,12 @@ void SpeedReaderURLLoader::ResumeReadingBodyFromNet() {
 void SpeedReaderURLLoader::OnBodyReadable(MojoResult) {
   DCHECK_EQ(State::kLoading, state_);
 
+  if (!CanReadBody()) {
+    // Resumed by OnChunkDistilled().
+    reading_paused_ = true;
+    return;
+  }
+
   size_t start_size = buffered_body_.size();
   uint32_t read_bytes = kReadBufferSize;
   buffered_body_.resize(start_size + read_bytes);
@@ -213,14 +293,51 @@ void SpeedReaderURLLoader::OnBodyReadable(MojoResult) {
 
   DCHECK_EQ(MOJO_RESULT_OK, result);
   buffered_body_.resize(start_size + read_bytes);
-  // TODO(iefremov): We actually can partially |pumpContent| to speedreader,
-  // but skipping it for now to simplify things. Pumping is not free in terms
-  // of CPU ticks, so we will have to keep alive speedreader instance on another
-  // thread.
+
+  if (distiller_ && buffered_body_.size() > kMaxDistillableBodySize)
+    StopDistilling();
+
+  if (distiller_) {
+    bytes_in_flight_ += read_bytes;
+    distill_task_runner_->PostTaskAndReply(
+        FROM_HERE,
+        base::BindOnce(&Distiller::Write, base::Unretained(distiller_.get()),
+                       base::StringPiece(buffered_body_.data() + start_size,
+                                         read_bytes)),
+        base::BindOnce(&SpeedReaderURLLoader::OnChunkDistilled,
+                       weak_factory_.GetWeakPtr(), read_bytes));
+  }
 
   body_consumer_watcher_.ArmOrNotify();
 }
 
+bool SpeedReaderURLLoader::CanReadBody() const {
+  // Let the distiller catch up before reading more.
+  if (bytes_in_flight_ > kMaxBytesInFlight)
+    return false;
+  // Chunks posted to the distiller point into |buffered_body_|, so it must
+  // not be reallocated until they have all been distilled.
+  return bytes_in_flight_ == 0 ||
+         buffered_body_.capacity() >= buffered_body_.size() + kReadBufferSize;
+}
+
+void SpeedReaderURLLoader::OnChunkDistilled(size_t chunk_size) {
+  DCHECK_GE(bytes_in_flight_, chunk_size);
+  bytes_in_flight_ -= chunk_size;
+  if (!reading_paused_ || !CanReadBody())
+    return;
+
+  reading_paused_ = false;
+  if (state_ == State::kLoading)
+    body_consumer_watcher_.ArmOrNotify();
+}
+
+void SpeedReaderURLLoader::StopDistilling() {
+  VLOG(2) << __func__ << " body is too large to distill: " << response_url_;
+  // Pending writes are still run before the deleter on the same sequence.
+  distiller_.reset();
+}
+
 void SpeedReaderURLLoader::OnBodyWritable(MojoResult r) {
   DCHECK_EQ(State::kSending, state_);
   if (bytes_remaining_in_buffer_ > 0) {
@@ -238,42 +355,29 @@ void SpeedReaderURLLoader::MaybeLaunchSpeedreader() {
   }
 
   VLOG(2) << __func__ << " buffered body size = " << buffered_body_.size();
-  bytes_remaining_in_buffer_ = buffered_body_.size();
 
-  if (bytes_remaining_in_buffer_ > 0) {
-    // Offload heavy distilling to another thread.
-    base::PostTaskAndReplyWithResult(
-        FROM_HERE, {base::ThreadPool(), base::TaskPriority::USER_BLOCKING},
-        base::BindOnce(
-            [](std::string data, std::unique_ptr<Rewriter> rewriter,
-               const std::string& stylesheet) -> auto {
-              SCOPED_UMA_HISTOGRAM_TIMER("Brave.Speedreader.Distill");
-              int written = rewriter->Write(data.c_str(), data.length());
-              // Error occurred
-              if (written != 0) {
-                return data;
-              }
-
-              rewriter->End();
-              const std::string& transformed = rewriter->GetOutput();
-
-              // TODO(brave-browser/issues/10372): would be better to pass
-              // explicit signal back from rewriter to indicate if content was
-              // found
-              if (transformed.length() < 1024) {
-                return data;
-              }
-
-              return stylesheet + transformed;
-            },
-            std::move(buffered_body_),
-            rewriter_service_->MakeRewriter(response_url_),
-            rewriter_service_->GetContentStylesheet()),
-        base::BindOnce(&SpeedReaderURLLoader::CompleteLoading,
-                       weak_factory_.GetWeakPtr()));
+  if (buffered_body_.empty() || !distiller_) {
+    CompleteLoading(std::move(buffered_body_));
     return;
   }
-  CompleteLoading(std::move(buffered_body_));
+
+  // Everything received so far has already been pumped into the distiller,
+  // only flushing the rewriter is left.
+  base::PostTaskAndReplyWithResult(
+      distill_task_runner_.get(), FROM_HERE,
+      base::BindOnce(&Distiller::Finish, base::Unretained(distiller_.get())),
+      base::BindOnce(&SpeedReaderURLLoader::OnDistillFinished,
+                     weak_factory_.GetWeakPtr()));
+}
+
+void SpeedReaderURLLoader::OnDistillFinished(std::string distilled) {
+  distiller_.reset();
+  if (distilled.empty()) {
+    CompleteLoading(std::move(buffered_body_));
+    return;
+  }
+  is_distilled_ = true;
+  CompleteLoading(std::move(distilled));
 }
 
 void SpeedReaderURLLoader::CompleteLoading(std::string body) {
@@ -354,6 +458,11 @@ void SpeedReaderURLLoader::SendReceivedBodyToClient() {
       NOTREACHED();
       return;
   }
+  if (is_distilled_ && !first_byte_sent_) {
+    first_byte_sent_ = true;
+    UMA_HISTOGRAM_TIMES("Brave.Speedreader.TimeToFirstByte",
+                        base::TimeTicks::Now() - body_start_time_);
+  }
   bytes_remaining_in_buffer_ -= bytes_sent;
   body_producer_watcher_.ArmOrNotify();
 }
@@ -6,6 +6,7 @@
 #ifndef BRAVE_COMPONENTS_SPEEDREADER_SPEEDREADER_URL_LOADER_H_
 #define BRAVE_COMPONENTS_SPEEDREADER_SPEEDREADER_URL_LOADER_H_
 
+#include <memory>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -13,7 +14,9 @@
 #include "base/callback.h"
 #include "base/memory/ref_counted.h"
 #include "base/memory/weak_ptr.h"
+#include "base/sequenced_task_runner.h"
 #include "base/strings/string_piece.h"
+#include "base/time/time.h"
 #include "mojo/public/cpp/bindings/binding.h"
 #include "mojo/public/cpp/bindings/pending_receiver.h"
 #include "mojo/public/cpp/bindings/pending_remote.h"
@@ -38,12 +41,16 @@ class SpeedreaderRewriterService;
 //               finished (= OnComplete() is called). When body is provided, the
 //               state is changed to kLoading. Otherwise the state goes to
 //               kCompleted.
-// kLoading: Receives the body from the source loader and distills the page.
-//            The received body is kept in this loader until distilling
-//            is finished. When all body has been received and distilling is
-//            done, this loader will dispatch queued messages like
-//            OnStartLoadingResponseBody() to the destination
-//            loader client, and then the state is changed to kSending.
+// kLoading: Receives the body from the source loader and feeds every chunk
+//           to the distiller on a worker sequence as it arrives, so
+//           distilling overlaps with the download. The received body is
+//           also kept in this loader as a fallback in case the page turns
+//           out not to be distillable. Reading from the source is paused
+//           while too many bytes are queued for the distiller. When all
+//           body has been received and distilling is done, this loader will
+//           dispatch queued messages like OnStartLoadingResponseBody() to
+//           the destination loader client, and then the state is changed to
+//           kSending.
 // kSending: Receives the body and sends it to the destination loader client.
 //           The state changes to kCompleted after all data is sent.
 // kCompleted: All data has been sent to the destination loader.
@@ -112,7 +119,11 @@ class SpeedReaderURLLoader : public network::mojom::URLLoaderClient,
 
   void OnBodyReadable(MojoResult);
   void OnBodyWritable(MojoResult);
+  bool CanReadBody() const;
   void MaybeLaunchSpeedreader();
+  void OnChunkDistilled(size_t chunk_size);
+  void OnDistillFinished(std::string distilled);
+  void StopDistilling();
 
   // Gets either distilled or untouched body.
   void CompleteLoading(std::string body);
@@ -142,6 +153,20 @@ class SpeedReaderURLLoader : public network::mojom::URLLoaderClient,
   std::string buffered_body_;
   size_t bytes_remaining_in_buffer_;
 
+  // Lives on |distill_task_runner_| and owns the rewriter. Reset once the
+  // page is known not to be distillable.
+  class Distiller;
+  scoped_refptr<base::SequencedTaskRunner> distill_task_runner_;
+  std::unique_ptr<Distiller, base::OnTaskRunnerDeleter> distiller_;
+  // Bytes posted to |distiller_| that it has not consumed yet. These are
+  // read in place from |buffered_body_|.
+  size_t bytes_in_flight_ = 0;
+  bool reading_paused_ = false;
+
+  bool is_distilled_ = false;
+  bool first_byte_sent_ = false;
+  base::TimeTicks body_start_time_;
+
   mojo::ScopedDataPipeConsumerHandle body_consumer_handle_;
   mojo::ScopedDataPipeProducerHandle body_producer_handle_;
   mojo::SimpleWatcher body_consumer_watcher_;
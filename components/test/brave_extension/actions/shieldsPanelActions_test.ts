@@ -4,7 +4,7 @@
 
 // Types
 import * as types from '../../../brave_extension/extension/brave_extension/constants/shieldsPanelTypes'
-import { ShieldDetails, BlockDetails } from '../../../brave_extension/extension/brave_extension/types/actions/shieldsPanelActions'
+import { ShieldDetails, BlockDetails, BlockedResourcesDetails } from '../../../brave_extension/extension/brave_extension/types/actions/shieldsPanelActions'
 import {
   BlockOptions,
   BlockFPOptions,
@@ -70,6 +70,19 @@ describe('shieldsPanelActions', () => {
     })
   })
 
+  it('resourcesBlocked action', () => {
+    const details: BlockedResourcesDetails = {
+      tabId: 2,
+      resources: [
+        { blockType: 'ads', subresource: 'https://www.brave.com/test' }
+      ]
+    }
+    expect(actions.resourcesBlocked(details)).toEqual({
+      type: types.RESOURCES_BLOCKED,
+      details
+    })
+  })
+
   it('blockAdsTrackers action', () => {
     const setting: BlockOptions = 'allow'
     expect(actions.blockAdsTrackers(setting)).toEqual({
@@ -4,7 +4,7 @@
 
 import '../../../../brave_extension/extension/brave_extension/background/events/shieldsEvents'
 import actions from '../../../../brave_extension/extension/brave_extension/background/actions/shieldsPanelActions'
-import { blockedResource } from '../../../testData'
+import { blockedResource, blockedResources } from '../../../testData'
 
 describe('shieldsEvents events', () => {
   describe('chrome.braveShields.onBlocked listener', () => {
@@ -24,4 +24,21 @@ describe('shieldsEvents events', () => {
       chrome.braveShields.onBlocked.emit(blockedResource)
     })
   })
+  describe('chrome.braveShields.onBlockedResources listener', () => {
+    let spy: jest.SpyInstance
+    beforeEach(() => {
+      spy = jest.spyOn(actions, 'resourcesBlocked')
+    })
+    afterEach(() => {
+      spy.mockRestore()
+    })
+    it('forward details to actions.resourcesBlocked', (cb) => {
+      chrome.braveShields.onBlockedResources.addListener((details) => {
+        expect(details).toBe(blockedResources)
+        expect(spy).toBeCalledWith(details)
+        cb()
+      })
+      chrome.braveShields.onBlockedResources.emit(blockedResources)
+    })
+  })
 })
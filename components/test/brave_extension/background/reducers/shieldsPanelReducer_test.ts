@@ -810,6 +810,34 @@ describe('braveShieldsPanelReducer', () => {
     })
   })
 
+  describe('RESOURCES_BLOCKED', () => {
+    let spy: jest.SpyInstance
+    beforeEach(() => {
+      spy = jest.spyOn(browserActionAPI, 'setBadgeText')
+    })
+    afterEach(() => {
+      spy.mockRestore()
+    })
+    it('updates all blocked resources with one badge text update', () => {
+      const nextState = shieldsPanelReducer(state, {
+        type: types.RESOURCES_BLOCKED,
+        details: {
+          tabId: 2,
+          resources: [
+            { blockType: 'ads', subresource: 'https://test.brave.com/ad' },
+            { blockType: 'ads', subresource: 'https://test.brave.com/ad' },
+            { blockType: 'trackers', subresource: 'https://test.brave.com/tracker' }
+          ]
+        }
+      })
+      expect(nextState.tabs[2].adsBlocked).toBe(1)
+      expect(nextState.tabs[2].adsBlockedResources).toEqual([ 'https://test.brave.com/ad' ])
+      expect(nextState.tabs[2].trackersBlocked).toBe(1)
+      expect(nextState.tabs[2].trackersBlockedResources).toEqual([ 'https://test.brave.com/tracker' ])
+      expect(spy).toBeCalledTimes(1)
+    })
+  })
+
   describe('BLOCK_ADS_TRACKERS', () => {
     let reloadTabSpy: jest.SpyInstance
     let setAllowAdsSpy: jest.SpyInstance
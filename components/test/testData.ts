@@ -9,7 +9,7 @@ import { defaultState as adblockData } from '../../components/brave_adblock_ui/s
 
 // Types
 import { Tab } from '../brave_extension/extension/brave_extension/types/state/shieldsPannelState'
-import { BlockDetails } from '../brave_extension/extension/brave_extension/types/actions/shieldsPanelActions'
+import { BlockDetails, BlockedResourcesDetails } from '../brave_extension/extension/brave_extension/types/actions/shieldsPanelActions'
 
 // Helpers
 import * as deepFreeze from 'deep-freeze-node'
@@ -102,6 +102,14 @@ export const blockedResource: BlockDetails = {
   subresource: 'https://www.brave.com/test'
 }
 
+export const blockedResources: BlockedResourcesDetails = {
+  tabId: 2,
+  resources: [
+    { blockType: 'ads', subresource: 'https://www.brave.com/test' },
+    { blockType: 'trackers', subresource: 'https://www.brave.com/tracker' }
+  ]
+}
+
 // see: https://developer.chrome.com/extensions/events
 interface OnMessageEvent extends chrome.events.Event<(message: object, options: any, responseCallback: any) => void> {
   emit: (message: object) => void
@@ -213,6 +221,7 @@ export const getMockChrome = () => {
     },
     braveShields: {
       onBlocked: new ChromeEvent(),
+      onBlockedResources: new ChromeEvent(),
       allowScriptsOnce: function (origins: Array<string>, tabId: number, cb: () => void) {
         setImmediate(cb)
       },
@@ -301,6 +310,7 @@ export const getMockChrome = () => {
         return Promise.resolve()
       },
       onBlocked: new ChromeEvent(),
+      onBlockedResources: new ChromeEvent(),
       allowScriptsOnce: function (origins: Array<string>, tabId: number, cb: () => void) {
         setImmediate(cb)
       },
@@ -0,0 +1,114 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_THIRD_PARTY_BLINK_RENDERER_BRAVE_AUDIO_FARBLER_H_
+#define BRAVE_THIRD_PARTY_BLINK_RENDERER_BRAVE_AUDIO_FARBLER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace brave {
+
+inline uint64_t lfsr_next(uint64_t v) {
+  const uint64_t zero = 0;
+  return ((v >> 1) | (((v << 62) ^ (v << 61)) & (~(~zero << 63) << 62)));
+}
+
+// Farbles WebAudio samples a whole buffer at a time. Every instance owns its
+// pseudo-random state, so farblers handed out to different contexts do not
+// interfere with each other.
+class AudioFarbler {
+ public:
+  // Leaves samples untouched.
+  AudioFarbler() = default;
+
+  static AudioFarbler ConstantMultiplier(double fudge_factor) {
+    AudioFarbler farbler;
+    farbler.mode_ = Mode::kConstantMultiplier;
+    farbler.fudge_factor_ = fudge_factor;
+    return farbler;
+  }
+
+  static AudioFarbler PseudoRandomSequence(uint64_t seed) {
+    AudioFarbler farbler;
+    farbler.mode_ = Mode::kPseudoRandomSequence;
+    farbler.seed_ = seed;
+    farbler.state_ = seed;
+    return farbler;
+  }
+
+  bool IsIdentity() const { return mode_ == Mode::kIdentity; }
+
+  // Farbles |length| samples of |data| in place. Same as calling
+  // FarbleSample() on every sample with indices 0 to |length| - 1.
+  void Farble(float* data, size_t length) {
+    switch (mode_) {
+      case Mode::kIdentity:
+        return;
+      case Mode::kConstantMultiplier: {
+        const double fudge_factor = fudge_factor_;
+        for (size_t i = 0; i < length; ++i)
+          data[i] = data[i] * fudge_factor;
+        return;
+      }
+      case Mode::kPseudoRandomSequence: {
+        // The LFSR itself is serial, so generate a block of states first and
+        // convert them in a separate loop the compiler can vectorize.
+        uint64_t states[kBlockSize];
+        uint64_t v = seed_;
+        for (size_t offset = 0; offset < length; offset += kBlockSize) {
+          const size_t remaining = length - offset;
+          const size_t count = remaining < kBlockSize ? remaining : kBlockSize;
+          for (size_t i = 0; i < count; ++i) {
+            v = lfsr_next(v);
+            states[i] = v;
+          }
+          float* block = data + offset;
+          for (size_t i = 0; i < count; ++i)
+            block[i] = ToSample(states[i]);
+        }
+        state_ = v;
+        return;
+      }
+    }
+  }
+
+  // Farbles a single sample. An |index| of zero restarts the pseudo-random
+  // sequence from the seed.
+  float FarbleSample(float value, size_t index) {
+    switch (mode_) {
+      case Mode::kIdentity:
+        return value;
+      case Mode::kConstantMultiplier:
+        return value * fudge_factor_;
+      case Mode::kPseudoRandomSequence:
+        if (index == 0)
+          state_ = seed_;
+        state_ = lfsr_next(state_);
+        return ToSample(state_);
+    }
+    return value;
+  }
+
+ private:
+  enum class Mode { kIdentity, kConstantMultiplier, kPseudoRandomSequence };
+
+  static constexpr size_t kBlockSize = 64;
+
+  // Maps an LFSR state to a pseudo-random float between 0 and 0.1.
+  static float ToSample(uint64_t v) {
+    const double maxUInt64AsDouble = UINT64_MAX;
+    return (v / maxUInt64AsDouble) / 10;
+  }
+
+  Mode mode_ = Mode::kIdentity;
+  double fudge_factor_ = 1.0;
+  uint64_t seed_ = 0;
+  uint64_t state_ = 0;
+};
+
+}  // namespace brave
+
+#endif  // BRAVE_THIRD_PARTY_BLINK_RENDERER_BRAVE_AUDIO_FARBLER_H_
@@ -0,0 +1,122 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <string.h>
+
+#include <random>
+#include <vector>
+
+#include "brave/third_party/blink/renderer/brave_audio_farbler.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+// npm run test -- brave_unit_tests --filter=BraveAudioFarblerTest.*
+
+using brave::AudioFarbler;
+
+namespace {
+
+// Ten seconds of interleaved stereo at 44.1kHz.
+constexpr size_t kSampleCount = 2 * 10 * 44100;
+
+// Per-sample reference implementations the farbler has to match bit for bit.
+float ReferenceConstantMultiplier(double fudge_factor,
+                                  float value,
+                                  size_t index) {
+  return value * fudge_factor;
+}
+
+float ReferencePseudoRandomSequence(uint64_t seed, float value, size_t index) {
+  static uint64_t v;
+  const double maxUInt64AsDouble = UINT64_MAX;
+  if (index == 0)
+    v = seed;
+  v = brave::lfsr_next(v);
+  return (v / maxUInt64AsDouble) / 10;
+}
+
+std::vector<float> MakeSamples(size_t count) {
+  std::mt19937 prng(42);
+  std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+  std::vector<float> samples(count);
+  for (float& sample : samples)
+    sample = distribution(prng);
+  return samples;
+}
+
+bool BitIdentical(const std::vector<float>& a, const std::vector<float>& b) {
+  return a.size() == b.size() &&
+         memcmp(a.data(), b.data(), a.size() * sizeof(float)) == 0;
+}
+
+}  // namespace
+
+TEST(BraveAudioFarblerTest, IdentityLeavesSamplesUntouched) {
+  const std::vector<float> original = MakeSamples(kSampleCount);
+  std::vector<float> samples = original;
+
+  AudioFarbler farbler;
+  EXPECT_TRUE(farbler.IsIdentity());
+  farbler.Farble(samples.data(), samples.size());
+
+  EXPECT_TRUE(BitIdentical(original, samples));
+}
+
+TEST(BraveAudioFarblerTest, ConstantMultiplierMatchesPerSamplePath) {
+  const double fudge_factor = 0.99 + 0.00731;
+  std::vector<float> expected = MakeSamples(kSampleCount);
+  std::vector<float> samples = expected;
+  for (size_t i = 0; i < expected.size(); ++i)
+    expected[i] = ReferenceConstantMultiplier(fudge_factor, expected[i], i);
+
+  AudioFarbler farbler = AudioFarbler::ConstantMultiplier(fudge_factor);
+  EXPECT_FALSE(farbler.IsIdentity());
+  farbler.Farble(samples.data(), samples.size());
+
+  EXPECT_TRUE(BitIdentical(expected, samples));
+}
+
+TEST(BraveAudioFarblerTest, PseudoRandomSequenceMatchesPerSamplePath) {
+  const uint64_t seed = 0x9e3779b97f4a7c15;
+  // Include lengths that are not a multiple of the internal block size.
+  for (size_t count : {size_t{1}, size_t{63}, size_t{65}, kSampleCount}) {
+    std::vector<float> expected = MakeSamples(count);
+    std::vector<float> samples = expected;
+    for (size_t i = 0; i < expected.size(); ++i)
+      expected[i] = ReferencePseudoRandomSequence(seed, expected[i], i);
+
+    AudioFarbler farbler = AudioFarbler::PseudoRandomSequence(seed);
+    farbler.Farble(samples.data(), samples.size());
+
+    EXPECT_TRUE(BitIdentical(expected, samples)) << count;
+  }
+}
+
+TEST(BraveAudioFarblerTest, FarbleSampleMatchesBatch) {
+  const uint64_t seed = 12345;
+  std::vector<float> batch = MakeSamples(1000);
+  std::vector<float> single = batch;
+
+  AudioFarbler batch_farbler = AudioFarbler::PseudoRandomSequence(seed);
+  batch_farbler.Farble(batch.data(), batch.size());
+  AudioFarbler single_farbler = AudioFarbler::PseudoRandomSequence(seed);
+  for (size_t i = 0; i < single.size(); ++i)
+    single[i] = single_farbler.FarbleSample(single[i], i);
+
+  EXPECT_TRUE(BitIdentical(batch, single));
+}
+
+TEST(BraveAudioFarblerTest, InstancesDoNotShareState) {
+  AudioFarbler first = AudioFarbler::PseudoRandomSequence(1);
+  AudioFarbler second = AudioFarbler::PseudoRandomSequence(2);
+
+  // Interleaving two sequences must not change either of them.
+  const float first_0 = first.FarbleSample(0, 0);
+  second.FarbleSample(0, 0);
+  const float first_1 = first.FarbleSample(0, 1);
+
+  AudioFarbler fresh = AudioFarbler::PseudoRandomSequence(1);
+  EXPECT_EQ(first_0, fresh.FarbleSample(0, 0));
+  EXPECT_EQ(first_1, fresh.FarbleSample(0, 1));
+}